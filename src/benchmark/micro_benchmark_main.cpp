@@ -0,0 +1,35 @@
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "micro_benchmark_utils.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_scheduler.hpp"
+
+int main(int argc, char** argv) {
+  const auto config = opossum::parse_micro_benchmark_config(argc, argv);
+
+  // The operators split their work into jobs, which would run one after another without a scheduler
+  opossum::CurrentScheduler::set(std::make_shared<opossum::TaskScheduler>(config.worker_count));
+
+  opossum::register_join_hash_benchmarks(config);
+  opossum::register_table_scan_benchmarks(config);
+  opossum::register_table_benchmarks(config);
+
+  // Results are printed as JSON by default so that they can be compared between versions. As later flags take
+  // precedence, --benchmark_format=console still works.
+  char json_format_flag[] = "--benchmark_format=json";
+  std::vector<char*> arguments{argv[0], json_format_flag};
+  arguments.insert(arguments.end(), argv + 1, argv + argc);
+  auto argument_count = static_cast<int>(arguments.size());
+
+  benchmark::Initialize(&argument_count, arguments.data());
+  if (benchmark::ReportUnrecognizedArguments(argument_count, arguments.data())) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+
+  opossum::CurrentScheduler::get()->finish();
+  return 0;
+}
@@ -0,0 +1,133 @@
+#include "micro_benchmark_utils.hpp"
+
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Removes the flag from the command line and returns its value if the argument at index has the form --name=value
+bool consume_flag(int& argc, char** argv, int index, const std::string& name, std::string& value) {
+  const auto prefix = "--" + name + "=";
+  const auto argument = std::string{argv[index]};
+  if (argument.compare(0, prefix.size(), prefix) != 0) {
+    return false;
+  }
+
+  value = argument.substr(prefix.size());
+  for (auto argument_id = index; argument_id < argc - 1; ++argument_id) {
+    argv[argument_id] = argv[argument_id + 1];
+  }
+  --argc;
+  return true;
+}
+
+template <typename T>
+T typed_benchmark_value(int32_t k) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    std::stringstream stream;
+    stream << std::setw(6) << std::setfill('0') << k;
+    return stream.str();
+  } else {
+    return static_cast<T>(k);
+  }
+}
+
+}  // namespace
+
+MicroBenchmarkConfig parse_micro_benchmark_config(int& argc, char** argv) {
+  auto config = MicroBenchmarkConfig{};
+
+  auto index = 1;
+  while (index < argc) {
+    std::string value;
+    if (consume_flag(argc, argv, index, "rows", value)) {
+      config.row_counts.clear();
+      for (const auto& row_count : _split<std::string>(value, ',')) {
+        config.row_counts.push_back(std::stoul(row_count));
+      }
+    } else if (consume_flag(argc, argv, index, "selectivities", value)) {
+      config.selectivities.clear();
+      for (const auto& selectivity : _split<std::string>(value, ',')) {
+        config.selectivities.push_back(std::stod(selectivity));
+        Assert(config.selectivities.back() >= 0.0 && config.selectivities.back() <= 1.0,
+               "Selectivities must be between 0 and 1");
+      }
+    } else if (consume_flag(argc, argv, index, "chunk_size", value)) {
+      config.chunk_size = static_cast<ChunkOffset>(std::stoul(value));
+      Assert(config.chunk_size > 0, "Chunk size must be greater than 0");
+    } else if (consume_flag(argc, argv, index, "tmp_directory", value)) {
+      config.tmp_directory = value;
+    } else if (consume_flag(argc, argv, index, "workers", value)) {
+      config.worker_count = std::stoul(value);
+      Assert(config.worker_count > 0, "At least one worker is required");
+    } else {
+      ++index;
+    }
+  }
+
+  return config;
+}
+
+std::shared_ptr<Table> create_benchmark_table(const std::string& data_type, size_t row_count, ChunkOffset chunk_size) {
+  auto table = std::make_shared<Table>(chunk_size);
+  table->add_column("a", data_type);
+
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    std::vector<Type> distinct_values(BENCHMARK_DISTINCT_VALUE_COUNT);
+    for (auto k = 0; k < BENCHMARK_DISTINCT_VALUE_COUNT; ++k) {
+      distinct_values[k] = typed_benchmark_value<Type>(k);
+    }
+
+    // 7919 is prime, so consecutive rows hop through all distinct values before any of them repeats
+    std::vector<Type> values(row_count);
+    for (size_t row = 0; row < row_count; ++row) {
+      values[row] = distinct_values[(row * 7919) % BENCHMARK_DISTINCT_VALUE_COUNT];
+    }
+    table->append_columns(std::move(values));
+  });
+
+  return table;
+}
+
+AllTypeVariant benchmark_value(const std::string& data_type, int32_t k) {
+  AllTypeVariant value;
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    value = typed_benchmark_value<Type>(k);
+  });
+  return value;
+}
+
+AllTypeVariant search_value_for_selectivity(const std::string& data_type, ScanType scan_type, double selectivity) {
+  const auto selected_value_count = static_cast<int32_t>(std::lround(selectivity * BENCHMARK_DISTINCT_VALUE_COUNT));
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+    case ScanType::OpNotEquals:
+      return benchmark_value(data_type, 0);
+    case ScanType::OpLessThan:
+      return benchmark_value(data_type, selected_value_count);
+    case ScanType::OpLessThanEquals:
+      return benchmark_value(data_type, selected_value_count - 1);
+    case ScanType::OpGreaterThan:
+      return benchmark_value(data_type, BENCHMARK_DISTINCT_VALUE_COUNT - selected_value_count - 1);
+    case ScanType::OpGreaterThanEquals:
+      return benchmark_value(data_type, BENCHMARK_DISTINCT_VALUE_COUNT - selected_value_count);
+  }
+  Fail("Unknown scan type");
+  return AllTypeVariant{};
+}
+
+}  // namespace opossum
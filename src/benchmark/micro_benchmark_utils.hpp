@@ -0,0 +1,59 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// number of distinct values in the columns of the generated benchmark tables
+constexpr int32_t BENCHMARK_DISTINCT_VALUE_COUNT = 1000;
+
+// the data types that every benchmark is run for
+const std::vector<std::string> BENCHMARK_DATA_TYPES{"int", "long", "float", "double", "string"};
+
+// Settings that can be passed to hyriseBenchmark in addition to the flags of Google Benchmark, e.g.,
+// ./hyriseBenchmark --rows=10000,1000000 --selectivities=0.01,0.5 --workers=4 --benchmark_filter=TableScan/int
+struct MicroBenchmarkConfig {
+  // number of rows of the generated tables
+  std::vector<size_t> row_counts{1'000'000};
+
+  // share of rows that the range predicates of scans select
+  std::vector<double> selectivities{0.001, 0.1, 0.5};
+
+  ChunkOffset chunk_size{100'000};
+
+  // where load_table benchmarks write their input files to
+  std::string tmp_directory{"/tmp"};
+
+  // number of workers of the TaskScheduler that runs the jobs of the operators
+  size_t worker_count{std::thread::hardware_concurrency()};
+};
+
+// Reads the settings from (and removes them from) the command line, leaving all other flags for Google Benchmark
+MicroBenchmarkConfig parse_micro_benchmark_config(int& argc, char** argv);
+
+// Creates a table with a single column "a" of the given type whose values are spread evenly over
+// BENCHMARK_DISTINCT_VALUE_COUNT distinct values in pseudo-random order
+std::shared_ptr<Table> create_benchmark_table(const std::string& data_type, size_t row_count, ChunkOffset chunk_size);
+
+// Returns the k-th smallest of the values used by create_benchmark_table. Strings are zero-padded, so that they are
+// ordered like the numbers they represent.
+AllTypeVariant benchmark_value(const std::string& data_type, int32_t k);
+
+// Returns a search value for which a scan with the given scan type selects roughly the given share of the rows of a
+// table created by create_benchmark_table. OpEquals and OpNotEquals always select 1 / BENCHMARK_DISTINCT_VALUE_COUNT
+// or all but that share of the rows.
+AllTypeVariant search_value_for_selectivity(const std::string& data_type, ScanType scan_type, double selectivity);
+
+// These are called by main() before Google Benchmark runs the registered benchmarks
+void register_join_hash_benchmarks(const MicroBenchmarkConfig& config);
+void register_table_scan_benchmarks(const MicroBenchmarkConfig& config);
+void register_table_benchmarks(const MicroBenchmarkConfig& config);
+
+}  // namespace opossum
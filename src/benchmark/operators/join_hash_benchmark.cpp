@@ -0,0 +1,103 @@
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Creates the executed inputs of a join in which every row of the probe input finds exactly one join partner. The
+// build input contains the keys 0 to row_count - 1 in random order, the probe input row_count random keys out of them.
+std::pair<std::shared_ptr<const AbstractOperator>, std::shared_ptr<const AbstractOperator>> create_join_inputs(
+    const std::string& data_type, size_t row_count, ChunkOffset chunk_size) {
+  std::mt19937 generator{42};
+  std::vector<size_t> build_keys(row_count);
+  std::iota(build_keys.begin(), build_keys.end(), size_t{0});
+  std::shuffle(build_keys.begin(), build_keys.end(), generator);
+
+  std::uniform_int_distribution<size_t> distribution{0, row_count - 1};
+  std::vector<size_t> probe_keys(row_count);
+  std::generate(probe_keys.begin(), probe_keys.end(), [&]() { return distribution(generator); });
+
+  const auto create_input = [&](const std::vector<size_t>& keys) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("a", data_type);
+    resolve_data_type(data_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+
+      std::vector<Type> values(keys.size());
+      std::transform(keys.cbegin(), keys.cend(), values.begin(), [](const size_t key) {
+        if constexpr (std::is_same_v<Type, std::string>) {
+          return std::to_string(key);
+        } else {
+          return static_cast<Type>(key);
+        }
+      });
+      table->append_columns(std::move(values));
+    });
+
+    auto input = std::make_shared<TableWrapper>(table);
+    input->execute();
+    return std::shared_ptr<const AbstractOperator>{input};
+  };
+
+  return {create_input(build_keys), create_input(probe_keys)};
+}
+
+// Without radix_bits, the join chooses them itself, i.e., it partitions large inputs
+void register_join_hash_benchmark(
+    const std::string& data_type, size_t row_count, ChunkOffset chunk_size, const std::optional<uint8_t> radix_bits,
+    const std::shared_ptr<std::pair<std::shared_ptr<const AbstractOperator>, std::shared_ptr<const AbstractOperator>>>&
+        cached_inputs) {
+  const auto radix_bits_name = radix_bits ? std::to_string(*radix_bits) : std::string{"auto"};
+  const auto name = "JoinHash/" + data_type + "/rows:" + std::to_string(row_count) + "/radix_bits:" + radix_bits_name;
+
+  benchmark::RegisterBenchmark(name.c_str(), [=](benchmark::State& state) {
+    // The inputs are only created when the first benchmark that uses them runs and then shared by the others
+    if (!cached_inputs->first) {
+      *cached_inputs = create_join_inputs(data_type, row_count, chunk_size);
+    }
+    const auto& [build_input, probe_input] = *cached_inputs;
+
+    for (auto _ : state) {
+      auto join = std::make_shared<JoinHash>(probe_input, build_input, JoinMode::Inner,
+                                             std::make_pair(ColumnID{0}, ColumnID{0}), radix_bits);
+      join->execute();
+      benchmark::DoNotOptimize(join->get_output());
+    }
+
+    state.SetItemsProcessed(state.iterations() * row_count * 2);
+    state.counters["radix_bits"] = radix_bits ? *radix_bits : JoinHash::default_radix_bits(row_count);
+  })->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+void register_join_hash_benchmarks(const MicroBenchmarkConfig& config) {
+  for (const auto row_count : config.row_counts) {
+    for (const auto& data_type : BENCHMARK_DATA_TYPES) {
+      const auto cached_inputs = std::make_shared<
+          std::pair<std::shared_ptr<const AbstractOperator>, std::shared_ptr<const AbstractOperator>>>();
+
+      // The non-partitioned hash join serves as the baseline for the radix-partitioned one
+      register_join_hash_benchmark(data_type, row_count, config.chunk_size, 0, cached_inputs);
+      register_join_hash_benchmark(data_type, row_count, config.chunk_size, std::nullopt, cached_inputs);
+    }
+  }
+}
+
+}  // namespace opossum
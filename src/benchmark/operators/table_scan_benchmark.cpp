@@ -0,0 +1,116 @@
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+enum class SegmentKind { Value, Dictionary, Reference };
+
+const std::map<SegmentKind, std::string> segment_kind_names{
+    {SegmentKind::Value, "ValueSegment"},
+    {SegmentKind::Dictionary, "DictionarySegment"},
+    {SegmentKind::Reference, "ReferenceSegment"}};
+
+const std::map<ScanType, std::string> scan_type_names{
+    {ScanType::OpEquals, "Equals"},         {ScanType::OpNotEquals, "NotEquals"},
+    {ScanType::OpLessThan, "LessThan"},     {ScanType::OpLessThanEquals, "LessThanEquals"},
+    {ScanType::OpGreaterThan, "GreaterThan"}, {ScanType::OpGreaterThanEquals, "GreaterThanEquals"}};
+
+// Creates the executed input operator of the scan. Reference segments are produced by a scan that selects all rows.
+std::shared_ptr<const AbstractOperator> create_scan_input(const std::string& data_type, SegmentKind segment_kind,
+                                                          size_t row_count, ChunkOffset chunk_size) {
+  const auto table = create_benchmark_table(data_type, row_count, chunk_size);
+  if (segment_kind == SegmentKind::Dictionary) {
+    std::vector<ChunkID> chunk_ids;
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (table->get_chunk(chunk_id).size() == chunk_size) {
+        chunk_ids.push_back(chunk_id);
+      }
+    }
+    table->compress_chunks(chunk_ids);
+  }
+
+  auto input = std::shared_ptr<AbstractOperator>{std::make_shared<TableWrapper>(table)};
+  input->execute();
+
+  if (segment_kind == SegmentKind::Reference) {
+    input = std::make_shared<TableScan>(input, ColumnID{0}, ScanType::OpGreaterThanEquals,
+                                        benchmark_value(data_type, 0));
+    input->execute();
+  }
+  return input;
+}
+
+std::string selectivity_name(double selectivity) {
+  std::stringstream stream;
+  stream << selectivity;
+  return stream.str();
+}
+
+void register_table_scan_benchmark(const std::string& data_type, SegmentKind segment_kind, ScanType scan_type,
+                                   size_t row_count, ChunkOffset chunk_size, const std::string& selectivity_name,
+                                   const AllTypeVariant& search_value,
+                                   const std::shared_ptr<std::shared_ptr<const AbstractOperator>>& cached_input) {
+  const auto name = "TableScan/" + data_type + "/" + segment_kind_names.at(segment_kind) + "/" +
+                    scan_type_names.at(scan_type) + "/rows:" + std::to_string(row_count) +
+                    "/selectivity:" + selectivity_name;
+
+  benchmark::RegisterBenchmark(name.c_str(), [=](benchmark::State& state) {
+    // The input is only created when the first benchmark that uses it runs and then shared by the others
+    if (!*cached_input) {
+      *cached_input = create_scan_input(data_type, segment_kind, row_count, chunk_size);
+    }
+
+    auto output_row_count = uint64_t{0};
+    for (auto _ : state) {
+      auto table_scan = std::make_shared<TableScan>(*cached_input, ColumnID{0}, scan_type, search_value);
+      table_scan->execute();
+      output_row_count = table_scan->get_output()->row_count();
+    }
+
+    state.SetItemsProcessed(state.iterations() * row_count);
+    state.counters["selectivity"] = static_cast<double>(output_row_count) / static_cast<double>(row_count);
+  })->Unit(benchmark::kMicrosecond);
+}
+
+}  // namespace
+
+void register_table_scan_benchmarks(const MicroBenchmarkConfig& config) {
+  for (const auto row_count : config.row_counts) {
+    for (const auto& data_type : BENCHMARK_DATA_TYPES) {
+      for (const auto& [segment_kind, segment_kind_name] : segment_kind_names) {
+        const auto cached_input = std::make_shared<std::shared_ptr<const AbstractOperator>>();
+
+        for (const auto& [scan_type, scan_type_name] : scan_type_names) {
+          if (scan_type == ScanType::OpEquals || scan_type == ScanType::OpNotEquals) {
+            // The selectivity of these scans is fixed by the number of distinct values
+            register_table_scan_benchmark(data_type, segment_kind, scan_type, row_count, config.chunk_size, "fixed",
+                                          search_value_for_selectivity(data_type, scan_type, 0.0), cached_input);
+            continue;
+          }
+
+          for (const auto selectivity : config.selectivities) {
+            register_table_scan_benchmark(data_type, segment_kind, scan_type, row_count, config.chunk_size,
+                                          selectivity_name(selectivity),
+                                          search_value_for_selectivity(data_type, scan_type, selectivity),
+                                          cached_input);
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace opossum
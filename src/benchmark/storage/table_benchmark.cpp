@@ -0,0 +1,114 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "../micro_benchmark_utils.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+namespace {
+
+void register_compress_chunk_benchmark(const std::string& data_type, EncodingType encoding_type,
+                                       const std::string& encoding_name, ChunkOffset chunk_size) {
+  const auto name = "Table::compress_chunk/" + data_type + "/" + encoding_name + "/rows:" + std::to_string(chunk_size);
+
+  benchmark::RegisterBenchmark(name.c_str(), [=](benchmark::State& state) {
+    for (auto _ : state) {
+      state.PauseTiming();
+      const auto table = create_benchmark_table(data_type, chunk_size, chunk_size);
+      state.ResumeTiming();
+
+      table->compress_chunk(ChunkID{0}, encoding_type);
+    }
+
+    state.SetItemsProcessed(state.iterations() * chunk_size);
+  })->Unit(benchmark::kMillisecond);
+}
+
+void register_append_benchmark(const std::string& data_type, size_t row_count, ChunkOffset chunk_size) {
+  const auto name = "Table::append/" + data_type + "/rows:" + std::to_string(row_count);
+
+  benchmark::RegisterBenchmark(name.c_str(), [=](benchmark::State& state) {
+    std::vector<AllTypeVariant> values(BENCHMARK_DISTINCT_VALUE_COUNT);
+    for (auto k = 0; k < BENCHMARK_DISTINCT_VALUE_COUNT; ++k) {
+      values[k] = benchmark_value(data_type, k);
+    }
+
+    for (auto _ : state) {
+      Table table{chunk_size};
+      table.add_column("a", data_type);
+      for (size_t row = 0; row < row_count; ++row) {
+        table.append({values[row % BENCHMARK_DISTINCT_VALUE_COUNT]});
+      }
+      benchmark::DoNotOptimize(table.row_count());
+    }
+
+    state.SetItemsProcessed(state.iterations() * row_count);
+  })->Unit(benchmark::kMillisecond);
+}
+
+void register_load_table_benchmark(size_t row_count, ChunkOffset chunk_size, const std::string& tmp_directory) {
+  const auto name = "load_table/rows:" + std::to_string(row_count);
+
+  benchmark::RegisterBenchmark(name.c_str(), [=](benchmark::State& state) {
+    // The file contains one column of each data type
+    const auto file_name = tmp_directory + "/hyrise_benchmark_" + std::to_string(row_count) + ".tbl";
+    {
+      std::ofstream file(file_name);
+      Assert(file.is_open(), "Could not write " + file_name);
+
+      for (size_t column_id = 0; column_id < BENCHMARK_DATA_TYPES.size(); ++column_id) {
+        file << (column_id ? "|" : "") << "column_" << column_id;
+      }
+      file << "\n";
+      for (size_t column_id = 0; column_id < BENCHMARK_DATA_TYPES.size(); ++column_id) {
+        file << (column_id ? "|" : "") << BENCHMARK_DATA_TYPES[column_id];
+      }
+      file << "\n";
+      for (size_t row = 0; row < row_count; ++row) {
+        const auto k = static_cast<int32_t>((row * 7919) % BENCHMARK_DISTINCT_VALUE_COUNT);
+        for (size_t column_id = 0; column_id < BENCHMARK_DATA_TYPES.size(); ++column_id) {
+          file << (column_id ? "|" : "") << type_cast<std::string>(benchmark_value(BENCHMARK_DATA_TYPES[column_id], k));
+        }
+        file << "\n";
+      }
+    }
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(load_table(file_name, chunk_size));
+    }
+
+    state.SetItemsProcessed(state.iterations() * row_count);
+    std::remove(file_name.c_str());
+  })->Unit(benchmark::kMillisecond);
+}
+
+}  // namespace
+
+void register_table_benchmarks(const MicroBenchmarkConfig& config) {
+  for (const auto& data_type : BENCHMARK_DATA_TYPES) {
+    register_compress_chunk_benchmark(data_type, EncodingType::Dictionary, "Dictionary", config.chunk_size);
+    register_compress_chunk_benchmark(data_type, EncodingType::RunLength, "RunLength", config.chunk_size);
+    if (data_type == "int" || data_type == "long") {
+      register_compress_chunk_benchmark(data_type, EncodingType::FrameOfReference, "FrameOfReference",
+                                        config.chunk_size);
+    }
+  }
+
+  for (const auto row_count : config.row_counts) {
+    for (const auto& data_type : BENCHMARK_DATA_TYPES) {
+      register_append_benchmark(data_type, row_count, config.chunk_size);
+    }
+    register_load_table_benchmark(row_count, config.chunk_size, config.tmp_directory);
+  }
+}
+
+}  // namespace opossum
@@ -1,8 +1,16 @@
 #include <iostream>
+#include <memory>
 
+#include "../lib/scheduler/current_scheduler.hpp"
+#include "../lib/scheduler/task_scheduler.hpp"
 #include "../lib/utils/assert.hpp"
 
 int main() {
+  // Without a scheduler, the jobs of the operators would run one after another
+  opossum::CurrentScheduler::set(std::make_shared<opossum::TaskScheduler>());
+
   opossum::Assert(true, "We can use opossum files here :)");
+
+  opossum::CurrentScheduler::get()->finish();
   return 0;
 }
@@ -15,6 +15,7 @@
 #include <boost/preprocessor/seq/transform.hpp>
 
 #include <cstdint>
+#include <iostream>
 #include <string>
 #include <vector>
 
@@ -24,6 +25,16 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
+// Represents NULL in an AllTypeVariant. Segments do not store NULLs, they only occur at positions of ReferenceSegments
+// that point to NULL_ROW_ID, e.g., in the output of outer joins. Two NullValues compare equal so that variants can be
+// compared and sorted; operators that compare values have to treat NULLs separately.
+struct NullValue {};
+
+inline bool operator==(const NullValue&, const NullValue&) { return true; }
+inline bool operator!=(const NullValue&, const NullValue&) { return false; }
+inline bool operator<(const NullValue&, const NullValue&) { return false; }
+inline std::ostream& operator<<(std::ostream& stream, const NullValue&) { return stream << "NULL"; }
+
 namespace detail {
 
 #define EXPAND_TO_HANA_TYPE(s, data, elem) boost::hana::type_c<elem>
@@ -60,8 +71,9 @@ static constexpr auto data_types = hana::transform(data_types_as_tuples, to_pair
 // Converts tuple to mpl vector
 using TypesAsMplVector = decltype(hana::to<hana::ext::boost::mpl::vector_tag>(types));
 
-// Creates boost::variant from mpl vector
-using AllTypeVariant = typename boost::make_variant_over<detail::TypesAsMplVector>::type;
+// Creates boost::variant from mpl vector, with NullValue as its first type
+using AllTypeVariant =
+    typename boost::make_variant_over<boost::mpl::push_front<detail::TypesAsMplVector, NullValue>::type>::type;
 
 }  // namespace detail
 
@@ -70,6 +82,11 @@ static constexpr auto data_types = detail::data_types;
 
 using AllTypeVariant = detail::AllTypeVariant;
 
+// A default-constructed AllTypeVariant is NULL
+static const AllTypeVariant NULL_VALUE;
+
+inline bool variant_is_null(const AllTypeVariant& value) { return value.which() == 0; }
+
 /**
  * @defgroup Macros for explicitly instantiating template classes
  *
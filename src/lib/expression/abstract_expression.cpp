@@ -0,0 +1,43 @@
+#include "abstract_expression.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+AbstractExpression::AbstractExpression(const ExpressionType type,
+                                       const std::vector<std::shared_ptr<AbstractExpression>>& arguments)
+    : _type(type), _arguments(arguments) {}
+
+ExpressionType AbstractExpression::type() const { return _type; }
+
+const std::vector<std::shared_ptr<AbstractExpression>>& AbstractExpression::arguments() const { return _arguments; }
+
+std::string AbstractExpression::_argument_description(const size_t argument_id) const {
+  const auto& argument = *_arguments[argument_id];
+  if (argument.type() == ExpressionType::Column || argument.type() == ExpressionType::Value) {
+    return argument.description();
+  }
+  return "(" + argument.description() + ")";
+}
+
+std::string common_data_type(const std::string& lhs, const std::string& rhs) {
+  if (lhs == "string" || rhs == "string") {
+    Assert(lhs == rhs, "Strings cannot be combined with numbers");
+    return "string";
+  }
+
+  static const auto numeric_data_types = std::vector<std::string>{"int", "long", "float", "double"};
+  const auto lhs_position = std::find(numeric_data_types.cbegin(), numeric_data_types.cend(), lhs);
+  const auto rhs_position = std::find(numeric_data_types.cbegin(), numeric_data_types.cend(), rhs);
+  Assert(lhs_position != numeric_data_types.cend() && rhs_position != numeric_data_types.cend(),
+         "Unknown data type " + lhs + " or " + rhs);
+  return *std::max(lhs_position, rhs_position);
+}
+
+}  // namespace opossum
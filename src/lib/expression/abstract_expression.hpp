@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class ExpressionType { Arithmetic, Case, Column, Comparison, Value };
+
+// Base class of the expressions that Projection computes its columns from, e.g., price * (1 - discount). Expressions
+// form a tree whose leaves are columns and literal values, and they are evaluated chunk by chunk by the
+// ExpressionEvaluator.
+class AbstractExpression : private Noncopyable {
+ public:
+  AbstractExpression(const ExpressionType type, const std::vector<std::shared_ptr<AbstractExpression>>& arguments);
+  virtual ~AbstractExpression() = default;
+
+  ExpressionType type() const;
+  const std::vector<std::shared_ptr<AbstractExpression>>& arguments() const;
+
+  // returns the data type of the expression's values, e.g., "int"
+  virtual std::string data_type() const = 0;
+
+  // returns a readable representation of the expression, which Projection uses as the name of its output column
+  virtual std::string description() const = 0;
+
+ protected:
+  // returns the description of an argument, in parentheses if it consists of several parts
+  std::string _argument_description(const size_t argument_id) const;
+
+  const ExpressionType _type;
+  const std::vector<std::shared_ptr<AbstractExpression>> _arguments;
+};
+
+// Returns the data type to which values of the two data types are converted when they are combined, i.e., the larger
+// one of two numeric types in the order int, long, float, double, or string for two strings. Strings cannot be combined
+// with numbers.
+std::string common_data_type(const std::string& lhs, const std::string& rhs);
+
+}  // namespace opossum
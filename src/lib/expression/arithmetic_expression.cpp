@@ -0,0 +1,46 @@
+#include "arithmetic_expression.hpp"
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ArithmeticExpression::ArithmeticExpression(const ArithmeticOperator arithmetic_operator,
+                                           const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right)
+    : AbstractExpression(ExpressionType::Arithmetic, {left, right}), _arithmetic_operator(arithmetic_operator) {
+  Assert(data_type() != "string", "Arithmetic is only supported on numbers");
+}
+
+ArithmeticOperator ArithmeticExpression::arithmetic_operator() const { return _arithmetic_operator; }
+
+const std::shared_ptr<AbstractExpression>& ArithmeticExpression::left_operand() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& ArithmeticExpression::right_operand() const { return _arguments[1]; }
+
+std::string ArithmeticExpression::data_type() const {
+  return common_data_type(left_operand()->data_type(), right_operand()->data_type());
+}
+
+std::string ArithmeticExpression::description() const {
+  auto operator_string = std::string{};
+  switch (_arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      operator_string = " + ";
+      break;
+    case ArithmeticOperator::Subtraction:
+      operator_string = " - ";
+      break;
+    case ArithmeticOperator::Multiplication:
+      operator_string = " * ";
+      break;
+    case ArithmeticOperator::Division:
+      operator_string = " / ";
+      break;
+  }
+  return _argument_description(0) + operator_string + _argument_description(1);
+}
+
+}  // namespace opossum
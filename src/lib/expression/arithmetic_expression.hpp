@@ -0,0 +1,30 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+enum class ArithmeticOperator { Addition, Subtraction, Multiplication, Division };
+
+// Combines two numeric expressions, whose values are converted to their common_data_type() first. Integers are divided
+// without remainder, and a division by zero results in NULL.
+class ArithmeticExpression : public AbstractExpression {
+ public:
+  ArithmeticExpression(const ArithmeticOperator arithmetic_operator, const std::shared_ptr<AbstractExpression>& left,
+                       const std::shared_ptr<AbstractExpression>& right);
+
+  ArithmeticOperator arithmetic_operator() const;
+  const std::shared_ptr<AbstractExpression>& left_operand() const;
+  const std::shared_ptr<AbstractExpression>& right_operand() const;
+
+  std::string data_type() const override;
+  std::string description() const override;
+
+ protected:
+  const ArithmeticOperator _arithmetic_operator;
+};
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#include "case_expression.hpp"
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CaseExpression::CaseExpression(const std::shared_ptr<AbstractExpression>& condition,
+                               const std::shared_ptr<AbstractExpression>& then_result,
+                               const std::shared_ptr<AbstractExpression>& else_result)
+    : AbstractExpression(ExpressionType::Case, {condition, then_result, else_result}) {
+  Assert(condition->data_type() != "string", "The condition of a CASE has to be numeric");
+  // Fails for a string and a number
+  data_type();
+}
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::condition() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::then_result() const { return _arguments[1]; }
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::else_result() const { return _arguments[2]; }
+
+std::string CaseExpression::data_type() const {
+  return common_data_type(then_result()->data_type(), else_result()->data_type());
+}
+
+std::string CaseExpression::description() const {
+  return "CASE WHEN " + condition()->description() + " THEN " + then_result()->description() + " ELSE " +
+         else_result()->description() + " END";
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// CASE WHEN condition THEN then_result ELSE else_result END. The condition is a numeric expression, usually a
+// ComparisonExpression, which is true for values other than zero and NULL. The results are either both numeric, in
+// which case they are converted to their common_data_type(), or both strings. Further WHEN clauses are expressed by
+// nesting another CaseExpression as else_result.
+class CaseExpression : public AbstractExpression {
+ public:
+  CaseExpression(const std::shared_ptr<AbstractExpression>& condition,
+                 const std::shared_ptr<AbstractExpression>& then_result,
+                 const std::shared_ptr<AbstractExpression>& else_result);
+
+  const std::shared_ptr<AbstractExpression>& condition() const;
+  const std::shared_ptr<AbstractExpression>& then_result() const;
+  const std::shared_ptr<AbstractExpression>& else_result() const;
+
+  std::string data_type() const override;
+  std::string description() const override;
+};
+
+}  // namespace opossum
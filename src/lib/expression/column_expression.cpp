@@ -0,0 +1,20 @@
+#include "column_expression.hpp"
+
+#include <string>
+
+namespace opossum {
+
+ColumnExpression::ColumnExpression(const ColumnID column_id, const std::string& data_type,
+                                   const std::string& column_name)
+    : AbstractExpression(ExpressionType::Column, {}),
+      _column_id(column_id),
+      _data_type(data_type),
+      _column_name(column_name) {}
+
+ColumnID ColumnExpression::column_id() const { return _column_id; }
+
+std::string ColumnExpression::data_type() const { return _data_type; }
+
+std::string ColumnExpression::description() const { return _column_name; }
+
+}  // namespace opossum
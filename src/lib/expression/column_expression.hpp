@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// References a column of the table that an expression is evaluated on. The data type and the name are given along with
+// the ColumnID, so that expressions can be created before the table exists. The ExpressionEvaluator checks the type.
+class ColumnExpression : public AbstractExpression {
+ public:
+  ColumnExpression(const ColumnID column_id, const std::string& data_type, const std::string& column_name);
+
+  ColumnID column_id() const;
+  std::string data_type() const override;
+  std::string description() const override;
+
+ protected:
+  const ColumnID _column_id;
+  const std::string _data_type;
+  const std::string _column_name;
+};
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#include "comparison_expression.hpp"
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+ComparisonExpression::ComparisonExpression(const ScanType scan_type, const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right)
+    : AbstractExpression(ExpressionType::Comparison, {left, right}), _scan_type(scan_type) {
+  // Fails for a string and a number
+  operand_data_type();
+}
+
+ScanType ComparisonExpression::scan_type() const { return _scan_type; }
+
+const std::shared_ptr<AbstractExpression>& ComparisonExpression::left_operand() const { return _arguments[0]; }
+
+const std::shared_ptr<AbstractExpression>& ComparisonExpression::right_operand() const { return _arguments[1]; }
+
+std::string ComparisonExpression::operand_data_type() const {
+  return common_data_type(left_operand()->data_type(), right_operand()->data_type());
+}
+
+std::string ComparisonExpression::data_type() const { return "int"; }
+
+std::string ComparisonExpression::description() const {
+  auto operator_string = std::string{};
+  switch (_scan_type) {
+    case ScanType::OpEquals:
+      operator_string = " = ";
+      break;
+    case ScanType::OpNotEquals:
+      operator_string = " != ";
+      break;
+    case ScanType::OpLessThan:
+      operator_string = " < ";
+      break;
+    case ScanType::OpLessThanEquals:
+      operator_string = " <= ";
+      break;
+    case ScanType::OpGreaterThan:
+      operator_string = " > ";
+      break;
+    case ScanType::OpGreaterThanEquals:
+      operator_string = " >= ";
+      break;
+  }
+  return _argument_description(0) + operator_string + _argument_description(1);
+}
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// Compares two expressions that are either both numeric or both strings. Numbers are converted to their
+// common_data_type() first. The result is an int, which is 1 for true and 0 for false, or NULL if an operand is NULL.
+class ComparisonExpression : public AbstractExpression {
+ public:
+  ComparisonExpression(const ScanType scan_type, const std::shared_ptr<AbstractExpression>& left,
+                       const std::shared_ptr<AbstractExpression>& right);
+
+  ScanType scan_type() const;
+  const std::shared_ptr<AbstractExpression>& left_operand() const;
+  const std::shared_ptr<AbstractExpression>& right_operand() const;
+
+  // returns the common_data_type() of the operands, in which they are compared
+  std::string operand_data_type() const;
+
+  std::string data_type() const override;
+  std::string description() const override;
+
+ protected:
+  const ScanType _scan_type;
+};
+
+}  // namespace opossum
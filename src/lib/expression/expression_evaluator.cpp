@@ -0,0 +1,265 @@
+#include "expression_evaluator.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arithmetic_expression.hpp"
+#include "case_expression.hpp"
+#include "column_expression.hpp"
+#include "comparison_expression.hpp"
+#include "operators/table_scan_impl.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_expression.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Combines two results row by row into result, which is NULL where one of them is NULL. The result has a single value
+// if both inputs have one, and row_count values otherwise.
+template <typename Result, typename T, typename Functor>
+void combine_results(const ExpressionResult<T>& lhs, const ExpressionResult<T>& rhs, const size_t row_count,
+                     ExpressionResult<Result>& result, const Functor& func) {
+  const auto size = lhs.values.size() == 1 && rhs.values.size() == 1 ? size_t{1} : row_count;
+
+  result.values.resize(size);
+  with_value_accessor(lhs, [&](const auto& lhs_value) {
+    with_value_accessor(rhs, [&](const auto& rhs_value) {
+      for (size_t row_id = 0; row_id < size; ++row_id) {
+        result.values[row_id] = func(lhs_value(row_id), rhs_value(row_id));
+      }
+    });
+  });
+
+  if (lhs.nulls.empty() && rhs.nulls.empty()) return;
+  result.nulls.resize(size);
+  for (size_t row_id = 0; row_id < size; ++row_id) {
+    result.nulls[row_id] = lhs.is_null(row_id) || rhs.is_null(row_id);
+  }
+}
+
+}  // namespace
+
+ExpressionEvaluator::ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id)
+    : _table(table), _chunk_id(chunk_id), _row_count(table->get_chunk(chunk_id).size()) {}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::evaluate(const AbstractExpression& expression) {
+  switch (expression.type()) {
+    case ExpressionType::Arithmetic:
+      return _evaluate_arithmetic<T>(static_cast<const ArithmeticExpression&>(expression));
+    case ExpressionType::Case:
+      return _evaluate_case<T>(static_cast<const CaseExpression&>(expression));
+    case ExpressionType::Column:
+      return _evaluate_column<T>(static_cast<const ColumnExpression&>(expression));
+    case ExpressionType::Comparison:
+      return _evaluate_comparison<T>(static_cast<const ComparisonExpression&>(expression));
+    case ExpressionType::Value:
+      return _evaluate_value<T>(static_cast<const ValueExpression&>(expression));
+  }
+  Fail("Unknown expression type");
+  return nullptr;
+}
+
+std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_to_segment(const AbstractExpression& expression) {
+  std::vector<bool> nulls;
+  auto segment = evaluate_to_segment(expression, nulls);
+  Assert(nulls.empty(), "ValueSegments cannot store NULLs");
+  return segment;
+}
+
+std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_to_segment(const AbstractExpression& expression,
+                                                                      std::vector<bool>& nulls) {
+  std::shared_ptr<BaseSegment> segment;
+  resolve_data_type(expression.data_type(), [&](auto type) {
+    using Type = typename decltype(type)::type;
+    const auto result = evaluate<Type>(expression);
+
+    nulls.clear();
+    if (std::any_of(result->nulls.cbegin(), result->nulls.cend(), [](const bool is_null) { return is_null; })) {
+      nulls.resize(_row_count);
+      for (size_t row_id = 0; row_id < _row_count; ++row_id) {
+        nulls[row_id] = result->is_null(row_id);
+      }
+    }
+
+    std::vector<Type> values;
+    if (result->values.size() != _row_count) {
+      values.assign(_row_count, result->values.front());
+    } else if (expression.type() == ExpressionType::Column) {
+      values = result->values;
+    } else {
+      values = std::move(result->values);
+    }
+    segment = std::make_shared<ValueSegment<Type>>(std::move(values));
+  });
+  return segment;
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_as(const AbstractExpression& expression) {
+  std::shared_ptr<ExpressionResult<T>> converted_result;
+  resolve_data_type(expression.data_type(), [&](auto type) {
+    using DataType = typename decltype(type)::type;
+    if constexpr (std::is_same_v<DataType, T>) {
+      converted_result = evaluate<T>(expression);
+    } else if constexpr (std::is_same_v<DataType, std::string> || std::is_same_v<T, std::string>) {
+      Fail("Strings cannot be combined with numbers");
+    } else {
+      const auto result = evaluate<DataType>(expression);
+      converted_result = std::make_shared<ExpressionResult<T>>();
+      converted_result->values.resize(result->values.size());
+      std::transform(result->values.cbegin(), result->values.cend(), converted_result->values.begin(),
+                     [](const DataType value) { return static_cast<T>(value); });
+      converted_result->nulls = result->nulls;
+    }
+  });
+  return converted_result;
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_column(const ColumnExpression& expression) {
+  const auto column_id = expression.column_id();
+  auto& column_result = _column_results[column_id];
+  if (column_result) return std::static_pointer_cast<ExpressionResult<T>>(column_result);
+
+  Assert(_table->column_type(column_id) == expression.data_type(),
+         "Column " + expression.description() + " does not have the data type " + expression.data_type());
+
+  auto result = std::make_shared<ExpressionResult<T>>();
+  result->values.resize(_row_count);
+  segment_iterate<T>(*_table->get_chunk(_chunk_id).get_segment(column_id), [&](const auto& position) {
+    if (position.is_null()) {
+      if (result->nulls.empty()) result->nulls.resize(_row_count);
+      result->nulls[position.chunk_offset()] = true;
+      return;
+    }
+    result->values[position.chunk_offset()] = T{position.value()};
+  });
+
+  column_result = result;
+  return result;
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_value(const ValueExpression& expression) {
+  auto result = std::make_shared<ExpressionResult<T>>();
+  result->values.emplace_back(get<T>(expression.value()));
+  return result;
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_arithmetic(const ArithmeticExpression& expression) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    Fail("Arithmetic is only supported on numbers");
+    return nullptr;
+  } else {
+    const auto left = _evaluate_as<T>(*expression.left_operand());
+    const auto right = _evaluate_as<T>(*expression.right_operand());
+    auto result = std::make_shared<ExpressionResult<T>>();
+
+    switch (expression.arithmetic_operator()) {
+      case ArithmeticOperator::Addition:
+        combine_results(*left, *right, _row_count, *result, std::plus<T>{});
+        break;
+      case ArithmeticOperator::Subtraction:
+        combine_results(*left, *right, _row_count, *result, std::minus<T>{});
+        break;
+      case ArithmeticOperator::Multiplication:
+        combine_results(*left, *right, _row_count, *result, std::multiplies<T>{});
+        break;
+      case ArithmeticOperator::Division:
+        combine_results(*left, *right, _row_count, *result,
+                        [](const T lhs, const T rhs) { return rhs == 0 ? T{0} : lhs / rhs; });
+        // A division by zero is NULL
+        with_value_accessor(*right, [&](const auto& right_value) {
+          for (size_t row_id = 0; row_id < result->values.size(); ++row_id) {
+            if (right_value(row_id) != 0) continue;
+            if (result->nulls.empty()) result->nulls.resize(result->values.size());
+            result->nulls[row_id] = true;
+          }
+        });
+        break;
+    }
+    return result;
+  }
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_comparison(const ComparisonExpression& expression) {
+  if constexpr (!std::is_same_v<T, int32_t>) {
+    Fail("Comparisons result in ints");
+    return nullptr;
+  } else {
+    auto result = std::make_shared<ExpressionResult<T>>();
+    resolve_data_type(expression.operand_data_type(), [&](auto type) {
+      using OperandType = typename decltype(type)::type;
+      const auto left = _evaluate_as<OperandType>(*expression.left_operand());
+      const auto right = _evaluate_as<OperandType>(*expression.right_operand());
+      with_comparator(expression.scan_type(), [&](const auto& comparator) {
+        combine_results(*left, *right, _row_count, *result, comparator);
+      });
+    });
+    return result;
+  }
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_case(const CaseExpression& expression) {
+  const auto then_result = _evaluate_as<T>(*expression.then_result());
+  const auto else_result = _evaluate_as<T>(*expression.else_result());
+  auto result = std::make_shared<ExpressionResult<T>>();
+
+  resolve_data_type(expression.condition()->data_type(), [&](auto type) {
+    using ConditionType = typename decltype(type)::type;
+    if constexpr (std::is_same_v<ConditionType, std::string>) {
+      Fail("The condition of a CASE has to be numeric");
+    } else {
+      const auto condition = evaluate<ConditionType>(*expression.condition());
+      const auto size = condition->values.size() == 1 && then_result->values.size() == 1 &&
+                                else_result->values.size() == 1
+                            ? size_t{1}
+                            : _row_count;
+
+      // Rows for which the condition is NULL get the else_result
+      std::vector<bool> is_true(size);
+      with_value_accessor(*condition, [&](const auto& condition_value) {
+        for (size_t row_id = 0; row_id < size; ++row_id) {
+          is_true[row_id] = condition_value(row_id) != 0 && !condition->is_null(row_id);
+        }
+      });
+
+      result->values.resize(size);
+      with_value_accessor(*then_result, [&](const auto& then_value) {
+        with_value_accessor(*else_result, [&](const auto& else_value) {
+          for (size_t row_id = 0; row_id < size; ++row_id) {
+            result->values[row_id] = is_true[row_id] ? then_value(row_id) : else_value(row_id);
+          }
+        });
+      });
+
+      if (then_result->nulls.empty() && else_result->nulls.empty()) return;
+      result->nulls.resize(size);
+      for (size_t row_id = 0; row_id < size; ++row_id) {
+        result->nulls[row_id] = is_true[row_id] ? then_result->is_null(row_id) : else_result->is_null(row_id);
+      }
+    }
+  });
+  return result;
+}
+
+#define EXPLICITLY_INSTANTIATE_EVALUATE(r, data, type) \
+  template std::shared_ptr<ExpressionResult<type>> ExpressionEvaluator::evaluate<type>(const AbstractExpression&);
+BOOST_PP_SEQ_FOR_EACH(EXPLICITLY_INSTANTIATE_EVALUATE, _, data_types_macro)
+
+}  // namespace opossum
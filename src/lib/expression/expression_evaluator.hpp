@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "expression_result.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class ArithmeticExpression;
+class BaseSegment;
+class CaseExpression;
+class ColumnExpression;
+class ComparisonExpression;
+class Table;
+class ValueExpression;
+
+// Evaluates expressions for all rows of one chunk of a table. Each expression is evaluated for the whole chunk at once,
+// on std::vectors of its data type, so no AllTypeVariant is created per row. Columns are materialized only once, even
+// if they are used by several expressions.
+class ExpressionEvaluator {
+ public:
+  ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id);
+
+  // T has to be the data type of the expression. The results of ColumnExpressions are shared by all expressions that
+  // use the column.
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> evaluate(const AbstractExpression& expression);
+
+  // Evaluates an expression into a ValueSegment. As ValueSegments cannot store NULLs, the expression must not be NULL
+  // for any row.
+  std::shared_ptr<BaseSegment> evaluate_to_segment(const AbstractExpression& expression);
+
+  // Like above, but rows for which the expression is NULL, e.g., because of a division by zero, are allowed. They are
+  // marked in nulls, which gets one entry per row, or is left empty if no row is NULL. Their values in the segment are
+  // unspecified.
+  std::shared_ptr<BaseSegment> evaluate_to_segment(const AbstractExpression& expression, std::vector<bool>& nulls);
+
+ protected:
+  // Evaluates an expression of any data type and converts its values to T. Both have to be numeric, or both strings.
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_as(const AbstractExpression& expression);
+
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_column(const ColumnExpression& expression);
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_value(const ValueExpression& expression);
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_arithmetic(const ArithmeticExpression& expression);
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_comparison(const ComparisonExpression& expression);
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_case(const CaseExpression& expression);
+
+  const std::shared_ptr<const Table> _table;
+  const ChunkID _chunk_id;
+  const size_t _row_count;
+
+  std::unordered_map<ColumnID, std::shared_ptr<BaseExpressionResult>> _column_results;
+};
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+namespace opossum {
+
+class BaseExpressionResult {
+ public:
+  virtual ~BaseExpressionResult() = default;
+};
+
+// The values of an expression for the rows of a chunk. A result with a single value, e.g., that of a literal, has that
+// value for all rows.
+template <typename T>
+class ExpressionResult : public BaseExpressionResult {
+ public:
+  using Type = T;
+
+  bool is_null(const size_t row_id) const { return !nulls.empty() && nulls[nulls.size() == 1 ? 0 : row_id]; }
+
+  std::vector<T> values;
+
+  // one entry per value, or empty if no value is NULL
+  std::vector<bool> nulls;
+};
+
+// Calls func with a functor that returns the value of result for a row. Results with a single value get a functor that
+// ignores the row, so that loops over the rows can be instantiated for each case without checking it for every row.
+template <typename T, typename Functor>
+void with_value_accessor(const ExpressionResult<T>& result, const Functor& func) {
+  const auto& values = result.values;
+  if (values.size() == 1) {
+    func([&](const size_t) -> const T& { return values[0]; });
+  } else {
+    func([&](const size_t row_id) -> const T& { return values[row_id]; });
+  }
+}
+
+}  // namespace opossum
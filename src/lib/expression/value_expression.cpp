@@ -0,0 +1,37 @@
+#include "value_expression.hpp"
+
+#include <sstream>
+#include <string>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ValueExpression::ValueExpression(const AllTypeVariant& value)
+    : AbstractExpression(ExpressionType::Value, {}), _value(value) {
+  Assert(!variant_is_null(_value), "ValueExpressions cannot be NULL");
+}
+
+const AllTypeVariant& ValueExpression::value() const { return _value; }
+
+std::string ValueExpression::data_type() const {
+  std::string data_type;
+  hana::for_each(data_types, [&](auto data_type_pair) {
+    using Type = typename decltype(+hana::second(data_type_pair))::type;
+    if (_value.type() == typeid(Type)) data_type = hana::first(data_type_pair);
+  });
+  return data_type;
+}
+
+std::string ValueExpression::description() const {
+  std::stringstream stream;
+  if (_value.type() == typeid(std::string)) {
+    stream << "'" << _value << "'";
+  } else {
+    stream << _value;
+  }
+  return stream.str();
+}
+
+}  // namespace opossum
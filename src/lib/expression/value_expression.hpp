@@ -0,0 +1,23 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_expression.hpp"
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+// A literal value, which is the same for all rows. It must not be NULL.
+class ValueExpression : public AbstractExpression {
+ public:
+  explicit ValueExpression(const AllTypeVariant& value);
+
+  const AllTypeVariant& value() const;
+  std::string data_type() const override;
+  std::string description() const override;
+
+ protected:
+  const AllTypeVariant _value;
+};
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#include "abstract_join_operator.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "operator_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+AbstractJoinOperator::AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                                           const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                                           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractOperator(left, right), _mode(mode), _column_ids(column_ids), _scan_type(scan_type) {}
+
+JoinMode AbstractJoinOperator::mode() const { return _mode; }
+
+const std::pair<ColumnID, ColumnID>& AbstractJoinOperator::column_ids() const { return _column_ids; }
+
+ScanType AbstractJoinOperator::scan_type() const { return _scan_type; }
+
+std::shared_ptr<const Table> AbstractJoinOperator::_create_output_table(
+    const std::vector<JoinPosLists>& pos_lists) const {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < left_table->column_count(); ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id));
+  }
+  if (_mode != JoinMode::Semi) {
+    for (ColumnID column_id{0}; column_id < right_table->column_count(); ++column_id) {
+      output_table->add_column_definition(right_table->column_name(column_id), right_table->column_type(column_id));
+    }
+  }
+
+  const auto add_output_segments = [&](Chunk& output_chunk, const std::shared_ptr<PosList>& left_pos_list,
+                                       const std::shared_ptr<PosList>& right_pos_list) {
+    add_reference_segments(output_chunk, left_table, left_pos_list);
+    if (_mode != JoinMode::Semi) {
+      add_reference_segments(output_chunk, right_table, right_pos_list);
+    }
+  };
+
+  for (const auto& [left_pos_list, right_pos_list] : pos_lists) {
+    if (!left_pos_list || left_pos_list->empty()) continue;
+
+    Chunk output_chunk;
+    add_output_segments(output_chunk, left_pos_list, right_pos_list);
+    output_table->emplace_chunk(output_chunk);
+  }
+
+  if (output_table->row_count() == 0) {
+    const auto empty_pos_list = std::make_shared<PosList>();
+    add_output_segments(output_table->get_chunk(ChunkID{0}), empty_pos_list, empty_pos_list);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The positions of the left and of the right input that make up one output chunk of a join
+using JoinPosLists = std::pair<std::shared_ptr<PosList>, std::shared_ptr<PosList>>;
+
+// AbstractJoinOperator is the super class of the operators that join two tables on a predicate between one column of
+// each of them, i.e., left_value <scan_type> right_value. See JoinMode for the supported modes. The output consists of
+// ReferenceSegments, first for all columns of the left input and then, except for semi joins, for all columns of the
+// right input. NULLs never find a join partner.
+class AbstractJoinOperator : public AbstractOperator {
+ public:
+  AbstractJoinOperator(const std::shared_ptr<const AbstractOperator> left,
+                       const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                       const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  JoinMode mode() const;
+  const std::pair<ColumnID, ColumnID>& column_ids() const;
+  ScanType scan_type() const;
+
+ protected:
+  // Creates the output table with one chunk per entry of pos_lists that is not empty. The PosLists of the right input
+  // are ignored for semi joins. If there are no matches at all, the initial chunk of the output table gets empty
+  // ReferenceSegments, like in TableScan.
+  std::shared_ptr<const Table> _create_output_table(const std::vector<JoinPosLists>& pos_lists) const;
+
+  JoinMode _mode;
+  std::pair<ColumnID, ColumnID> _column_ids;
+  ScanType _scan_type;
+};
+
+}  // namespace opossum
@@ -14,7 +14,26 @@ AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator>
                                    const std::shared_ptr<const AbstractOperator> right)
     : _input_left(left), _input_right(right) {}
 
-void AbstractOperator::execute() { _output = _on_execute(); }
+std::ostream& operator<<(std::ostream& stream, const OperatorPerformanceData& performance_data) {
+  stream << std::chrono::duration_cast<std::chrono::microseconds>(performance_data.walltime).count() << " us, "
+         << performance_data.input_row_count_left << " + " << performance_data.input_row_count_right << " input rows, "
+         << performance_data.output_row_count << " output rows in " << performance_data.output_chunk_count
+         << " chunks, " << performance_data.output_memory_usage << " bytes";
+  return stream;
+}
+
+void AbstractOperator::execute() {
+  const auto begin = std::chrono::steady_clock::now();
+  _output = _on_execute();
+  const auto end = std::chrono::steady_clock::now();
+
+  _performance_data.walltime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin);
+  _performance_data.input_row_count_left = _input_left ? _input_table_left()->row_count() : 0;
+  _performance_data.input_row_count_right = _input_right ? _input_table_right()->row_count() : 0;
+  _performance_data.output_row_count = _output->row_count();
+  _performance_data.output_chunk_count = _output->chunk_count();
+  _performance_data.output_memory_usage = _creates_output() ? _output->estimate_memory_usage() : 0;
+}
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
   DebugAssert(_output != nullptr, "Output can't be null, execute() has to be called before get_output");
@@ -22,6 +41,14 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const { return _performance_data; }
+
+bool AbstractOperator::_creates_output() const { return true; }
+
 std::shared_ptr<const Table> AbstractOperator::_input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::_input_table_right() const { return _input_right->get_output(); }
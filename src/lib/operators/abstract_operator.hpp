@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+#include <iostream>
 #include <memory>
 #include <string>
 #include <vector>
@@ -10,13 +12,29 @@ namespace opossum {
 
 class Table;
 
+// Collected by AbstractOperator::execute() for every operator, so that slow operators of a plan can be found without a
+// profiler. The input row counts are 0 for operators without the respective input.
+struct OperatorPerformanceData {
+  // time spent in _on_execute(), not including the computation of the other fields
+  std::chrono::nanoseconds walltime{0};
+  uint64_t input_row_count_left{0};
+  uint64_t input_row_count_right{0};
+  uint64_t output_row_count{0};
+  uint32_t output_chunk_count{0};
+  // estimated size of the output table, see Table::estimate_memory_usage(). It is 0 for operators that pass on an
+  // existing table, e.g., GetTable, as they do not allocate their output.
+  size_t output_memory_usage{0};
+};
+
+std::ostream& operator<<(std::ostream& stream, const OperatorPerformanceData& performance_data);
+
 // AbstractOperator is the abstract super class for all operators.
 // All operators have up to two input tables and one output table.
 // Their lifecycle has three phases:
 // 1. The operator is constructed. Previous operators are not guaranteed to have already executed, so operators must not
 // call get_output in their execute method
-// 2. The execute method is called from the outside (usually by the scheduler). This is where the heavy lifting is done.
-// By now, the input operators have already executed.
+// 2. The execute method is called from the outside (usually by the scheduler, see OperatorTask). This is where the
+// heavy lifting is done. By now, the input operators have already executed.
 // 3. The consumer (usually another operator) calls get_output. This should be very cheap. It is only guaranteed to
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
@@ -36,8 +54,12 @@ class AbstractOperator : private Noncopyable {
   AbstractOperator(AbstractOperator&&) = default;
   AbstractOperator& operator=(AbstractOperator&&) = default;
 
+  // executes the operator and records its performance data
   void execute();
 
+  // returns the name of the operator, e.g., for printing plans and their performance data
+  virtual const std::string name() const = 0;
+
   // returns the result of the operator
   std::shared_ptr<const Table> get_output() const;
 
@@ -45,12 +67,19 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
 
+  // returns the performance data of the last execution, i.e., all zeros if the operator has not been executed yet
+  const OperatorPerformanceData& performance_data() const;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
   // asynchronous execution
   virtual std::shared_ptr<const Table> _on_execute() = 0;
 
+  // returns whether _on_execute() creates the output table, which is false for operators that return a table that
+  // already exists, such as their input. Only created tables are part of the output memory usage.
+  virtual bool _creates_output() const;
+
   std::shared_ptr<const Table> _input_table_left() const;
   std::shared_ptr<const Table> _input_table_right() const;
 
@@ -60,6 +89,8 @@ class AbstractOperator : private Noncopyable {
 
   // Is nullptr until the operator is executed
   std::shared_ptr<const Table> _output;
+
+  OperatorPerformanceData _performance_data;
 };
 
 }  // namespace opossum
@@ -0,0 +1,508 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Group ids and the ids of the values of group-by columns have the width of ValueIDs, so that the ValueIDs of a
+// DictionarySegment can be decoded directly into them
+using GroupID = ValueID::base_type;
+
+// marks the rows that are not part of any group because of a NULL in a group-by column
+constexpr GroupID NULL_GROUP_ID = std::numeric_limits<GroupID>::max();
+
+// Combinations of group ids are looked up in an array instead of a hash table if there are at most this many of them,
+// or at most as many as the chunk has rows
+constexpr uint64_t DENSE_GROUP_ID_LIMIT = 1 << 16;
+
+// Assigns ids to the values of a group-by column, first per chunk and then across all chunks
+class BaseGroupByColumn {
+ public:
+  virtual ~BaseGroupByColumn() = default;
+
+  // Writes the chunk-local id of the value of each row of the chunk into local_ids, or NULL_GROUP_ID for NULLs, and
+  // returns the number of distinct chunk-local ids. Can be called for different chunks concurrently.
+  virtual GroupID assign_local_ids(const Chunk& chunk, const ChunkID chunk_id, std::vector<GroupID>& local_ids) = 0;
+
+  // Returns the id across all chunks for each chunk-local id of a chunk. Has to be called once per chunk, and not
+  // concurrently.
+  virtual std::vector<GroupID> global_ids(const ChunkID chunk_id) = 0;
+
+  // Returns a ValueSegment with the values of the given ids across all chunks
+  virtual std::shared_ptr<BaseSegment> values(const std::vector<GroupID>& global_ids) const = 0;
+};
+
+template <typename T>
+class GroupByColumn : public BaseGroupByColumn {
+ public:
+  GroupByColumn(const ColumnID column_id, const ChunkID chunk_count)
+      : _column_id(column_id), _chunk_dictionaries(chunk_count), _chunk_values(chunk_count) {}
+
+  GroupID assign_local_ids(const Chunk& chunk, const ChunkID chunk_id, std::vector<GroupID>& local_ids) override {
+    const auto segment = chunk.get_segment(_column_id);
+    local_ids.resize(segment->size());
+
+    // The ValueIDs already are dense ids of the values of the chunk
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      dictionary_segment->attribute_vector()->decode_into(0, local_ids);
+      _chunk_dictionaries[chunk_id] = dictionary_segment->dictionary();
+      return static_cast<GroupID>(_chunk_dictionaries[chunk_id]->size());
+    }
+
+    // Strings are hashed as string_views into chunk_values, which holds a copy of each distinct value of the chunk
+    auto& chunk_values = _chunk_values[chunk_id];
+    std::unordered_map<SegmentValueType<T>, GroupID> local_id_by_value;
+    segment_iterate<T>(*segment, [&](const auto& position) {
+      if (position.is_null()) {
+        local_ids[position.chunk_offset()] = NULL_GROUP_ID;
+        return;
+      }
+
+      auto entry = local_id_by_value.find(position.value());
+      if (entry == local_id_by_value.end()) {
+        const auto& value = chunk_values.emplace_back(position.value());
+        entry = local_id_by_value.emplace(SegmentValueType<T>{value}, chunk_values.size() - 1).first;
+      }
+      local_ids[position.chunk_offset()] = entry->second;
+    });
+    return static_cast<GroupID>(chunk_values.size());
+  }
+
+  std::vector<GroupID> global_ids(const ChunkID chunk_id) override {
+    std::vector<GroupID> global_ids;
+    const auto add_global_id = [&](const SegmentValueType<T>& value) {
+      auto entry = _global_id_by_value.find(value);
+      if (entry == _global_id_by_value.end()) {
+        const auto& global_value = _global_values.emplace_back(value);
+        entry = _global_id_by_value.emplace(SegmentValueType<T>{global_value}, _global_values.size() - 1).first;
+      }
+      global_ids.emplace_back(entry->second);
+    };
+
+    if (const auto& dictionary = _chunk_dictionaries[chunk_id]) {
+      global_ids.reserve(dictionary->size());
+      for (size_t value_id = 0; value_id < dictionary->size(); ++value_id) {
+        add_global_id((*dictionary)[value_id]);
+      }
+    } else {
+      global_ids.reserve(_chunk_values[chunk_id].size());
+      for (const auto& value : _chunk_values[chunk_id]) {
+        add_global_id(value);
+      }
+    }
+
+    _chunk_dictionaries[chunk_id] = nullptr;
+    _chunk_values[chunk_id] = {};
+    return global_ids;
+  }
+
+  std::shared_ptr<BaseSegment> values(const std::vector<GroupID>& global_ids) const override {
+    std::vector<T> values(global_ids.size());
+    for (size_t index = 0; index < global_ids.size(); ++index) {
+      values[index] = _global_values[global_ids[index]];
+    }
+    return std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+
+ protected:
+  const ColumnID _column_id;
+
+  // for each chunk, either its dictionary or its distinct values, in the order of their chunk-local ids
+  std::vector<std::shared_ptr<const DictionaryType<T>>> _chunk_dictionaries;
+  std::vector<std::deque<T>> _chunk_values;
+
+  // the distinct values of all chunks in the order of their global ids, which the keys of _global_id_by_value point to
+  std::deque<T> _global_values;
+  std::unordered_map<SegmentValueType<T>, GroupID> _global_id_by_value;
+};
+
+// Computes one aggregate, first for the groups of each chunk and then for the groups across all chunks
+class BaseAggregator {
+ public:
+  virtual ~BaseAggregator() = default;
+
+  // Aggregates the rows of a chunk into the chunk-local groups given by group_ids. Can be called for different chunks
+  // concurrently.
+  virtual void aggregate_chunk(const Chunk& chunk, const ChunkID chunk_id, const std::vector<GroupID>& group_ids,
+                               const GroupID group_count) = 0;
+
+  // Merges the aggregates of the chunk-local groups into the groups across all chunks given by global_group_ids.
+  // Must not be called concurrently.
+  virtual void merge_chunk(const ChunkID chunk_id, const std::vector<GroupID>& global_group_ids,
+                           const GroupID global_group_count) = 0;
+
+  // Returns a ValueSegment with the aggregate of each group across all chunks
+  virtual std::shared_ptr<BaseSegment> values(const GroupID global_group_count) = 0;
+};
+
+template <typename T, AggregateFunction function>
+class Aggregator : public BaseAggregator {
+ public:
+  // MIN and MAX keep values of the column type, SUMs are kept as int64_t or double and AVGs as double sums
+  using AccumulatorType = std::conditional_t<
+      function == AggregateFunction::Min || function == AggregateFunction::Max, T,
+      std::conditional_t<function == AggregateFunction::Sum && std::is_integral_v<T>, int64_t, double>>;
+  using ResultType =
+      std::conditional_t<function == AggregateFunction::Count, int64_t,
+                         std::conditional_t<function == AggregateFunction::Avg, double, AccumulatorType>>;
+
+  // The aggregate of a group, where count is the number of values that were aggregated
+  struct State {
+    AccumulatorType value{};
+    int64_t count{0};
+  };
+
+  Aggregator(const std::optional<ColumnID> column_id, const ChunkID chunk_count)
+      : _column_id(column_id), _chunk_states(chunk_count) {}
+
+  void aggregate_chunk(const Chunk& chunk, const ChunkID chunk_id, const std::vector<GroupID>& group_ids,
+                       const GroupID group_count) override {
+    auto& states = _chunk_states[chunk_id];
+    states.resize(group_count);
+
+    if (!_column_id) {
+      for (const auto group_id : group_ids) {
+        if (group_id != NULL_GROUP_ID) ++states[group_id].count;
+      }
+      return;
+    }
+
+    segment_iterate<T>(*chunk.get_segment(*_column_id), [&](const auto& position) {
+      const auto group_id = group_ids[position.chunk_offset()];
+      if (group_id == NULL_GROUP_ID || position.is_null()) return;
+
+      auto& state = states[group_id];
+      if constexpr (function == AggregateFunction::Min) {
+        if (state.count == 0 || position.value() < state.value) state.value = AccumulatorType{position.value()};
+      } else if constexpr (function == AggregateFunction::Max) {
+        if (state.count == 0 || state.value < position.value()) state.value = AccumulatorType{position.value()};
+      } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+        state.value += position.value();
+      }
+      ++state.count;
+    });
+  }
+
+  void merge_chunk(const ChunkID chunk_id, const std::vector<GroupID>& global_group_ids,
+                   const GroupID global_group_count) override {
+    _states.resize(global_group_count);
+
+    const auto& chunk_states = _chunk_states[chunk_id];
+    for (GroupID group_id = 0; group_id < chunk_states.size(); ++group_id) {
+      const auto& chunk_state = chunk_states[group_id];
+      if (chunk_state.count == 0) continue;
+
+      auto& state = _states[global_group_ids[group_id]];
+      if constexpr (function == AggregateFunction::Min) {
+        if (state.count == 0 || chunk_state.value < state.value) state.value = chunk_state.value;
+      } else if constexpr (function == AggregateFunction::Max) {
+        if (state.count == 0 || state.value < chunk_state.value) state.value = chunk_state.value;
+      } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+        state.value += chunk_state.value;
+      }
+      state.count += chunk_state.count;
+    }
+
+    _chunk_states[chunk_id] = {};
+  }
+
+  std::shared_ptr<BaseSegment> values(const GroupID global_group_count) override {
+    _states.resize(global_group_count);
+
+    std::vector<ResultType> values(global_group_count);
+    for (GroupID group_id = 0; group_id < global_group_count; ++group_id) {
+      const auto& state = _states[group_id];
+      if constexpr (function == AggregateFunction::Count) {
+        values[group_id] = state.count;
+      } else if constexpr (function == AggregateFunction::Avg) {
+        values[group_id] = state.count > 0 ? state.value / static_cast<double>(state.count) : 0.0;
+      } else {
+        values[group_id] = state.value;
+      }
+    }
+    return std::make_shared<ValueSegment<ResultType>>(std::move(values));
+  }
+
+ protected:
+  const std::optional<ColumnID> _column_id;
+  std::vector<std::vector<State>> _chunk_states;
+  std::vector<State> _states;
+};
+
+template <typename T>
+std::unique_ptr<BaseAggregator> make_aggregator(const AggregateColumnDefinition& definition,
+                                                const ChunkID chunk_count) {
+  switch (definition.function) {
+    case AggregateFunction::Min:
+      return std::make_unique<Aggregator<T, AggregateFunction::Min>>(definition.column_id, chunk_count);
+    case AggregateFunction::Max:
+      return std::make_unique<Aggregator<T, AggregateFunction::Max>>(definition.column_id, chunk_count);
+    case AggregateFunction::Count:
+      return std::make_unique<Aggregator<T, AggregateFunction::Count>>(definition.column_id, chunk_count);
+    case AggregateFunction::Sum:
+    case AggregateFunction::Avg:
+      if constexpr (std::is_same_v<T, std::string>) {
+        Fail("SUM and AVG are not defined for strings");
+      } else {
+        if (definition.function == AggregateFunction::Sum) {
+          return std::make_unique<Aggregator<T, AggregateFunction::Sum>>(definition.column_id, chunk_count);
+        }
+        return std::make_unique<Aggregator<T, AggregateFunction::Avg>>(definition.column_id, chunk_count);
+      }
+  }
+  Fail("Unknown aggregate function");
+  return nullptr;
+}
+
+// Combines the chunk-local group ids of the previous group-by columns with the chunk-local ids of the values of the
+// next group-by column into new group ids, in place, and returns the number of new groups. The new groups are numbered
+// in the order of their first occurrence. group_local_ids holds the local id of each group for every group-by column
+// and is extended by the next column.
+GroupID combine_group_ids(std::vector<GroupID>& group_ids, const GroupID group_count,
+                          const std::vector<GroupID>& local_ids, const GroupID local_id_count,
+                          std::vector<std::vector<GroupID>>& group_local_ids) {
+  std::vector<std::vector<GroupID>> combined_group_local_ids(group_local_ids.size() + 1);
+
+  // combined_ids maps each combination of a group id and a local id to its new group id plus one, so that zero, the
+  // default value of both the array and the hash table, marks combinations that did not occur yet
+  const auto combine = [&](auto& combined_ids) {
+    for (size_t row = 0; row < group_ids.size(); ++row) {
+      const auto group_id = group_ids[row];
+      const auto local_id = local_ids[row];
+      if (group_id == NULL_GROUP_ID || local_id == NULL_GROUP_ID) {
+        group_ids[row] = NULL_GROUP_ID;
+        continue;
+      }
+
+      auto& combined_id = combined_ids[uint64_t{group_id} * local_id_count + local_id];
+      if (combined_id == 0) {
+        for (size_t column = 0; column < group_local_ids.size(); ++column) {
+          combined_group_local_ids[column].emplace_back(group_local_ids[column][group_id]);
+        }
+        combined_group_local_ids.back().emplace_back(local_id);
+        combined_id = static_cast<GroupID>(combined_group_local_ids.back().size());
+      }
+      group_ids[row] = combined_id - 1;
+    }
+  };
+
+  const auto combination_count = uint64_t{group_count} * local_id_count;
+  if (combination_count <= std::max(DENSE_GROUP_ID_LIMIT, uint64_t{group_ids.size()})) {
+    std::vector<GroupID> combined_ids(combination_count);
+    combine(combined_ids);
+  } else {
+    std::unordered_map<uint64_t, GroupID> combined_ids;
+    combine(combined_ids);
+  }
+
+  group_local_ids = std::move(combined_group_local_ids);
+  return static_cast<GroupID>(group_local_ids.back().size());
+}
+
+// The groups of a chunk, with the chunk-local id of each group for every group-by column
+struct ChunkGroups {
+  GroupID group_count{0};
+  std::vector<std::vector<GroupID>> group_local_ids;
+};
+
+std::string aggregate_column_name(const Table& table, const AggregateColumnDefinition& definition) {
+  const auto argument = definition.column_id ? table.column_name(*definition.column_id) : std::string{"*"};
+  switch (definition.function) {
+    case AggregateFunction::Min:
+      return "MIN(" + argument + ")";
+    case AggregateFunction::Max:
+      return "MAX(" + argument + ")";
+    case AggregateFunction::Sum:
+      return "SUM(" + argument + ")";
+    case AggregateFunction::Avg:
+      return "AVG(" + argument + ")";
+    case AggregateFunction::Count:
+      return "COUNT(" + argument + ")";
+  }
+  Fail("Unknown aggregate function");
+  return "";
+}
+
+std::string aggregate_column_type(const Table& table, const AggregateColumnDefinition& definition) {
+  switch (definition.function) {
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      return table.column_type(*definition.column_id);
+    case AggregateFunction::Sum: {
+      const auto& column_type = table.column_type(*definition.column_id);
+      return column_type == "int" || column_type == "long" ? "long" : "double";
+    }
+    case AggregateFunction::Avg:
+      return "double";
+    case AggregateFunction::Count:
+      return "long";
+  }
+  Fail("Unknown aggregate function");
+  return "";
+}
+
+}  // namespace
+
+Aggregate::Aggregate(const std::shared_ptr<const AbstractOperator> in,
+                     const std::vector<AggregateColumnDefinition>& aggregates,
+                     const std::vector<ColumnID>& group_by_column_ids)
+    : AbstractOperator(in), _aggregates(aggregates), _group_by_column_ids(group_by_column_ids) {
+  for (const auto& aggregate : _aggregates) {
+    Assert(aggregate.column_id || aggregate.function == AggregateFunction::Count,
+           "Only COUNT can be computed without a column");
+  }
+}
+
+const std::string Aggregate::name() const { return "Aggregate"; }
+
+const std::vector<AggregateColumnDefinition>& Aggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& Aggregate::group_by_column_ids() const { return _group_by_column_ids; }
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  std::vector<std::unique_ptr<BaseGroupByColumn>> group_by_columns;
+  for (const auto& column_id : _group_by_column_ids) {
+    resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      group_by_columns.emplace_back(std::make_unique<GroupByColumn<Type>>(column_id, chunk_count));
+    });
+  }
+
+  // COUNT(*) does not read any values, so its aggregator is instantiated for an arbitrary type
+  std::vector<std::unique_ptr<BaseAggregator>> aggregators;
+  for (const auto& aggregate : _aggregates) {
+    const auto& data_type = aggregate.column_id ? input_table->column_type(*aggregate.column_id) : "int";
+    resolve_data_type(data_type, [&](auto type) {
+      using Type = typename decltype(type)::type;
+      aggregators.emplace_back(make_aggregator<Type>(aggregate, chunk_count));
+    });
+  }
+
+  // Each job groups and aggregates one chunk. Without group-by columns, all rows of a chunk form a single group.
+  std::vector<ChunkGroups> chunk_groups(chunk_count);
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (input_table->get_chunk(chunk_id).size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      std::vector<GroupID> group_ids(chunk.size(), 0);
+      auto& groups = chunk_groups[chunk_id];
+      groups.group_count = 1;
+
+      for (size_t column = 0; column < group_by_columns.size(); ++column) {
+        std::vector<GroupID> local_ids;
+        const auto local_id_count = group_by_columns[column]->assign_local_ids(chunk, chunk_id, local_ids);
+
+        if (column == 0) {
+          // The local ids of the first column are the group ids, so a single group-by column needs no hashing at all
+          group_ids = std::move(local_ids);
+          groups.group_count = local_id_count;
+          groups.group_local_ids.emplace_back(local_id_count);
+          std::iota(groups.group_local_ids.back().begin(), groups.group_local_ids.back().end(), GroupID{0});
+        } else {
+          groups.group_count =
+              combine_group_ids(group_ids, groups.group_count, local_ids, local_id_count, groups.group_local_ids);
+        }
+      }
+
+      for (const auto& aggregator : aggregators) {
+        aggregator->aggregate_chunk(chunk, chunk_id, group_ids, groups.group_count);
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // Merge the groups of all chunks. With a single group-by column, its ids across all chunks are the group ids.
+  // Otherwise, the combinations of these ids are numbered with a hash table.
+  auto global_group_count = GroupID{group_by_columns.empty() ? 1u : 0u};
+  std::vector<std::vector<GroupID>> global_group_column_ids(group_by_columns.size());
+  std::unordered_map<std::vector<GroupID>, GroupID, boost::hash<std::vector<GroupID>>> global_group_id_by_column_ids;
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& groups = chunk_groups[chunk_id];
+    if (groups.group_count == 0) continue;
+
+    std::vector<std::vector<GroupID>> column_global_ids;
+    for (const auto& group_by_column : group_by_columns) {
+      column_global_ids.emplace_back(group_by_column->global_ids(chunk_id));
+    }
+
+    std::vector<GroupID> global_group_ids(groups.group_count, 0);
+    if (group_by_columns.size() == 1) {
+      global_group_ids = std::move(column_global_ids.front());
+      for (const auto global_group_id : global_group_ids) {
+        global_group_count = std::max(global_group_count, global_group_id + 1);
+      }
+    } else if (group_by_columns.size() > 1) {
+      std::vector<GroupID> column_ids(group_by_columns.size());
+      for (GroupID group_id = 0; group_id < groups.group_count; ++group_id) {
+        for (size_t column = 0; column < group_by_columns.size(); ++column) {
+          column_ids[column] = column_global_ids[column][groups.group_local_ids[column][group_id]];
+        }
+
+        const auto [entry, inserted] = global_group_id_by_column_ids.emplace(column_ids, global_group_count);
+        if (inserted) {
+          for (size_t column = 0; column < group_by_columns.size(); ++column) {
+            global_group_column_ids[column].emplace_back(column_ids[column]);
+          }
+          ++global_group_count;
+        }
+        global_group_ids[group_id] = entry->second;
+      }
+    }
+
+    for (const auto& aggregator : aggregators) {
+      aggregator->merge_chunk(chunk_id, global_group_ids, global_group_count);
+    }
+  }
+
+  if (group_by_columns.size() == 1) {
+    global_group_column_ids.front().resize(global_group_count);
+    std::iota(global_group_column_ids.front().begin(), global_group_column_ids.front().end(), GroupID{0});
+  }
+
+  // Create the output, with the group-by columns followed by the aggregates
+  auto output_table = std::make_shared<Table>();
+  Chunk output_chunk;
+  for (size_t column = 0; column < group_by_columns.size(); ++column) {
+    const auto column_id = _group_by_column_ids[column];
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+    output_chunk.add_segment(group_by_columns[column]->values(global_group_column_ids[column]));
+  }
+  for (size_t aggregate_id = 0; aggregate_id < _aggregates.size(); ++aggregate_id) {
+    output_table->add_column_definition(aggregate_column_name(*input_table, _aggregates[aggregate_id]),
+                                        aggregate_column_type(*input_table, _aggregates[aggregate_id]));
+    output_chunk.add_segment(aggregators[aggregate_id]->values(global_group_count));
+  }
+  output_table->emplace_chunk(output_chunk);
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class AggregateFunction { Min, Max, Sum, Avg, Count };
+
+// An aggregate computed by the Aggregate operator. Without a column, the function has to be Count, which then counts
+// all rows of a group, i.e., COUNT(*).
+struct AggregateColumnDefinition {
+  std::optional<ColumnID> column_id;
+  AggregateFunction function;
+};
+
+// Groups the rows of a table by the values of the group-by columns and computes the aggregates for each group, like
+// SELECT <group-by columns>, <aggregates> FROM input GROUP BY <group-by columns>. The output is a single chunk of
+// ValueSegments: first the group-by columns, then the aggregates, which are named like "SUM(a)" or "COUNT(*)". SUMs
+// of integers are longs and those of floating-point numbers doubles, AVGs are doubles and COUNTs are longs. MIN and
+// MAX have the type of their column. Strings cannot be summed or averaged. Without group-by columns, the output
+// consists of a single row, even if the input is empty. The order of the groups is unspecified, e.g., groups of a
+// dictionary-encoded column come in the order of the dictionary, so the output has to be sorted if an order is needed.
+//
+// Aggregates ignore NULLs, so COUNT(column) counts the values that are not NULL. As ValueSegments cannot store NULLs,
+// rows with a NULL in a group-by column are not part of any group, and MIN, MAX, SUM and AVG of a group without values
+// are 0 or an empty string.
+//
+// Each chunk is grouped and aggregated by its own job. The values of a group-by column are identified by chunk-local
+// ids first. For DictionarySegments, these are the ValueIDs from the attribute vector, so grouping by such a column
+// requires neither hashing nor comparing values, and the aggregates are accumulated in arrays indexed by ValueID.
+// Other segments are assigned ids with a hash table. Ids of several group-by columns are combined with an array if
+// the number of combinations is small, and with a hash table otherwise. Only then are the distinct values of each chunk
+// mapped to ids across all chunks, and the aggregates of the chunk-local groups merged.
+class Aggregate : public AbstractOperator {
+ public:
+  Aggregate(const std::shared_ptr<const AbstractOperator> in, const std::vector<AggregateColumnDefinition>& aggregates,
+            const std::vector<ColumnID>& group_by_column_ids);
+
+  const std::string name() const override;
+
+  const std::vector<AggregateColumnDefinition>& aggregates() const;
+  const std::vector<ColumnID>& group_by_column_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::vector<AggregateColumnDefinition> _aggregates;
+  std::vector<ColumnID> _group_by_column_ids;
+};
+
+}  // namespace opossum
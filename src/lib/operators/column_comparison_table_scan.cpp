@@ -0,0 +1,239 @@
+#include "column_comparison_table_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "operator_utils.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "table_scan_impl.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Calls func(values, nulls) with the values of a segment. ValueSegments pass their own values, all other segments are
+// read into a vector first. nulls has one byte per row that tells whether it is NULL, or is empty if no row is NULL.
+template <typename T, typename Functor>
+void with_segment_values(const BaseSegment& segment, const Functor& func) {
+  std::vector<uint8_t> nulls;
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    func(value_segment->values(), nulls);
+    return;
+  }
+
+  std::vector<SegmentValueType<T>> values(segment.size());
+  nulls.resize(segment.size());
+  auto has_nulls = false;
+  segment_iterate<T>(segment, [&](const auto& position) {
+    values[position.chunk_offset()] = position.value();
+    nulls[position.chunk_offset()] = position.is_null();
+    has_nulls |= position.is_null();
+  });
+  if (!has_nulls) nulls.clear();
+  func(values, nulls);
+}
+
+// Merges two sorted dictionaries and assigns each of their values its position in the merged order, where equal values
+// of both dictionaries share a position. Comparing these positions gives the same result as comparing the values.
+template <typename T>
+void merge_dictionary_positions(const DictionaryType<T>& left_dictionary, const DictionaryType<T>& right_dictionary,
+                                std::vector<ValueID::base_type>& left_positions,
+                                std::vector<ValueID::base_type>& right_positions) {
+  left_positions.resize(left_dictionary.size());
+  right_positions.resize(right_dictionary.size());
+
+  size_t left_index = 0;
+  size_t right_index = 0;
+  ValueID::base_type position = 0;
+  while (left_index < left_dictionary.size() || right_index < right_dictionary.size()) {
+    const auto left_is_smaller = right_index == right_dictionary.size() ||
+                                 (left_index < left_dictionary.size() &&
+                                  left_dictionary[left_index] < right_dictionary[right_index]);
+    const auto right_is_smaller = left_index == left_dictionary.size() ||
+                                  (right_index < right_dictionary.size() &&
+                                   right_dictionary[right_index] < left_dictionary[left_index]);
+    if (!right_is_smaller) left_positions[left_index++] = position;
+    if (!left_is_smaller) right_positions[right_index++] = position;
+    ++position;
+  }
+}
+
+// returns true if no pair of values in the ranges of the two statistics can fulfill "left <scan_type> right"
+template <typename T>
+bool can_prune_comparison(const SegmentStatistics& left_statistics, const ScanType scan_type,
+                          const SegmentStatistics& right_statistics) {
+  const auto left_min = type_cast<T>(left_statistics.min);
+  const auto left_max = type_cast<T>(left_statistics.max);
+  const auto right_min = type_cast<T>(right_statistics.min);
+  const auto right_max = type_cast<T>(right_statistics.max);
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return left_max < right_min || right_max < left_min;
+    case ScanType::OpNotEquals:
+      return left_min == left_max && right_min == right_max && left_min == right_min;
+    case ScanType::OpLessThan:
+      return !(left_min < right_max);
+    case ScanType::OpLessThanEquals:
+      return right_max < left_min;
+    case ScanType::OpGreaterThan:
+      return !(right_min < left_max);
+    case ScanType::OpGreaterThanEquals:
+      return left_max < right_min;
+  }
+  Fail("Unrecognized ScanType");
+  return false;
+}
+
+// Sets one byte per row of the chunk that tells whether the values of the two columns fulfill the comparison
+template <typename LeftType, typename RightType>
+void scan_chunk(const Chunk& chunk, const ColumnID left_column_id, const ScanType scan_type,
+                const ColumnID right_column_id, std::vector<uint8_t>& matches) {
+  // The segments are held for the whole scan, as a compression might replace them in the chunk meanwhile
+  const auto left_segment = chunk.get_segment(left_column_id);
+  const auto right_segment = chunk.get_segment(right_column_id);
+
+  if constexpr (std::is_same_v<LeftType, RightType>) {
+    const auto left_dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<LeftType>>(left_segment);
+    const auto right_dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<RightType>>(right_segment);
+    if (left_dictionary_segment && right_dictionary_segment) {
+      std::vector<ValueID::base_type> left_positions;
+      std::vector<ValueID::base_type> right_positions;
+      merge_dictionary_positions<LeftType>(*left_dictionary_segment->dictionary(),
+                                           *right_dictionary_segment->dictionary(), left_positions, right_positions);
+
+      std::vector<ValueID::base_type> left_value_ids(matches.size());
+      std::vector<ValueID::base_type> right_value_ids(matches.size());
+      left_dictionary_segment->attribute_vector()->decode_into(0, left_value_ids);
+      right_dictionary_segment->attribute_vector()->decode_into(0, right_value_ids);
+
+      with_comparator(scan_type, [&](const auto compare) {
+        for (size_t row_id = 0; row_id < matches.size(); ++row_id) {
+          matches[row_id] = compare(left_positions[left_value_ids[row_id]], right_positions[right_value_ids[row_id]]);
+        }
+      });
+      return;
+    }
+  }
+
+  with_segment_values<LeftType>(*left_segment, [&](const auto& left_values, const auto& left_nulls) {
+    with_segment_values<RightType>(*right_segment, [&](const auto& right_values, const auto& right_nulls) {
+      with_comparator(scan_type, [&](const auto compare) {
+        if constexpr (std::is_arithmetic_v<LeftType>) {
+          // Numbers of different types are compared in their common type, e.g., int and float as float
+          using CommonType = std::common_type_t<LeftType, RightType>;
+          for (size_t row_id = 0; row_id < matches.size(); ++row_id) {
+            matches[row_id] =
+                compare(static_cast<CommonType>(left_values[row_id]), static_cast<CommonType>(right_values[row_id]));
+          }
+        } else {
+          for (size_t row_id = 0; row_id < matches.size(); ++row_id) {
+            matches[row_id] = compare(left_values[row_id], right_values[row_id]);
+          }
+        }
+      });
+
+      for (const auto* nulls : {&left_nulls, &right_nulls}) {
+        if (nulls->empty()) continue;
+        for (size_t row_id = 0; row_id < matches.size(); ++row_id) {
+          matches[row_id] &= !(*nulls)[row_id];
+        }
+      }
+    });
+  });
+}
+
+}  // namespace
+
+ColumnComparisonTableScan::ColumnComparisonTableScan(const std::shared_ptr<const AbstractOperator> in,
+                                                     const ColumnID left_column_id, const ScanType scan_type,
+                                                     const ColumnID right_column_id)
+    : AbstractOperator(in),
+      _left_column_id(left_column_id),
+      _scan_type(scan_type),
+      _right_column_id(right_column_id) {}
+
+const std::string ColumnComparisonTableScan::name() const { return "ColumnComparisonTableScan"; }
+
+ColumnID ColumnComparisonTableScan::left_column_id() const { return _left_column_id; }
+
+ScanType ColumnComparisonTableScan::scan_type() const { return _scan_type; }
+
+ColumnID ColumnComparisonTableScan::right_column_id() const { return _right_column_id; }
+
+size_t ColumnComparisonTableScan::pruned_chunk_count() const { return _pruned_chunk_count; }
+
+std::shared_ptr<const Table> ColumnComparisonTableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+  const auto& left_type = input_table->column_type(_left_column_id);
+  const auto& right_type = input_table->column_type(_right_column_id);
+  Assert((left_type == "string") == (right_type == "string"), "Strings can only be compared with strings");
+
+  // Every chunk is scanned by its own job into its own PosList, like in TableScan. Pruned and empty chunks keep a
+  // nullptr.
+  std::vector<std::shared_ptr<PosList>> pos_lists(chunk_count);
+  size_t pruned_chunk_count = 0;
+
+  // The string_views of string columns point into the segments, which are kept until all jobs are done
+  std::vector<std::shared_ptr<const BaseSegment>> string_segments;
+  if (left_type == "string") {
+    string_segments = collect_value_segments(*input_table, _left_column_id);
+    const auto right_segments = collect_value_segments(*input_table, _right_column_id);
+    string_segments.insert(string_segments.end(), right_segments.cbegin(), right_segments.cend());
+  }
+
+  resolve_data_type(left_type, [&](auto left_type_object) {
+    using LeftType = typename decltype(left_type_object)::type;
+
+    resolve_data_type(right_type, [&](auto right_type_object) {
+      using RightType = typename decltype(right_type_object)::type;
+
+      if constexpr (std::is_same_v<LeftType, std::string> == std::is_same_v<RightType, std::string>) {
+        std::vector<std::shared_ptr<AbstractTask>> jobs;
+        for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+          const auto& chunk = input_table->get_chunk(chunk_id);
+          if (chunk.size() == 0) continue;
+
+          // Statistics are only compared for columns of the same type, which covers the common case of, e.g., two
+          // date columns
+          if constexpr (std::is_same_v<LeftType, RightType>) {
+            const auto left_statistics = chunk.get_statistics(_left_column_id);
+            const auto right_statistics = chunk.get_statistics(_right_column_id);
+            if (left_statistics && right_statistics &&
+                can_prune_comparison<LeftType>(*left_statistics, _scan_type, *right_statistics)) {
+              ++pruned_chunk_count;
+              continue;
+            }
+          }
+
+          jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+            const auto& chunk = input_table->get_chunk(chunk_id);
+            std::vector<uint8_t> matches(chunk.size());
+            scan_chunk<LeftType, RightType>(chunk, _left_column_id, _scan_type, _right_column_id, matches);
+
+            pos_lists[chunk_id] = matches_to_pos_list(matches, chunk_id);
+          }));
+        }
+        CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+      }
+    });
+  });
+  _pruned_chunk_count = pruned_chunk_count;
+
+  return create_reference_output_table(input_table, pos_lists);
+}
+
+}  // namespace opossum
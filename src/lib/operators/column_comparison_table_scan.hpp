@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Selects the rows for which "left_column <scan_type> right_column" holds, e.g., ship_date > order_date, where both
+// columns belong to the input table. Numeric columns can be compared with each other regardless of their types,
+// string columns only with string columns. The output consists of ReferenceSegments, like that of TableScan. NULLs
+// never match.
+//
+// Each chunk is scanned by its own job. If both segments of a chunk are DictionarySegments of the same type, their
+// dictionaries are merged into a common order once, so that each row compares two integers instead of two values.
+// Otherwise, both segments are read into typed vectors, or used directly if they are ValueSegments, and compared in a
+// single loop without branches. Chunks whose min/max statistics show that no pair of values can match are skipped.
+class ColumnComparisonTableScan : public AbstractOperator {
+ public:
+  ColumnComparisonTableScan(const std::shared_ptr<const AbstractOperator> in, const ColumnID left_column_id,
+                            const ScanType scan_type, const ColumnID right_column_id);
+
+  const std::string name() const override;
+
+  ColumnID left_column_id() const;
+  ScanType scan_type() const;
+  ColumnID right_column_id() const;
+
+  // returns the number of input chunks that were skipped based on their min/max statistics
+  size_t pruned_chunk_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _left_column_id;
+  const ScanType _scan_type;
+  const ColumnID _right_column_id;
+  size_t _pruned_chunk_count{0};
+};
+
+}  // namespace opossum
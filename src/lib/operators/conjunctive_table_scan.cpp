@@ -0,0 +1,326 @@
+#include "conjunctive_table_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "operator_utils.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// All predicates of a ConjunctiveTableScan on one column
+class BaseColumnPredicates {
+ public:
+  virtual ~BaseColumnPredicates() = default;
+
+  // returns whether no row of the chunk can fulfill the predicates, based on the chunk's min/max statistics
+  virtual bool can_prune(const Chunk& chunk) const = 0;
+
+  // returns the estimated share of the rows of the chunk that fulfill the predicates
+  virtual double estimate_selectivity(const Chunk& chunk) const = 0;
+
+  // clears the matches of the rows of the chunk that do not fulfill the predicates
+  virtual void scan(const Chunk& chunk, std::vector<uint8_t>& matches) const = 0;
+};
+
+template <typename T>
+class ColumnPredicates : public BaseColumnPredicates {
+ public:
+  ColumnPredicates(const ColumnID column_id, const std::vector<ScanPredicate>& predicates) : _column_id(column_id) {
+    for (const auto& predicate : predicates) {
+      const auto search_value = type_cast<T>(predicate.search_value);
+      switch (predicate.scan_type) {
+        case ScanType::OpEquals:
+          _restrict_lower_bound(search_value, true);
+          _restrict_upper_bound(search_value, true);
+          break;
+        case ScanType::OpNotEquals:
+          _excluded_values.emplace_back(search_value);
+          break;
+        case ScanType::OpLessThan:
+          _restrict_upper_bound(search_value, false);
+          break;
+        case ScanType::OpLessThanEquals:
+          _restrict_upper_bound(search_value, true);
+          break;
+        case ScanType::OpGreaterThan:
+          _restrict_lower_bound(search_value, false);
+          break;
+        case ScanType::OpGreaterThanEquals:
+          _restrict_lower_bound(search_value, true);
+          break;
+      }
+    }
+  }
+
+  bool can_prune(const Chunk& chunk) const override {
+    // Contradicting predicates, e.g., a < 3 AND a > 5, match no row of any chunk
+    if (_lower_bound && _upper_bound &&
+        (*_upper_bound < *_lower_bound ||
+         (*_upper_bound == *_lower_bound && !(_lower_bound_is_inclusive && _upper_bound_is_inclusive)))) {
+      return true;
+    }
+
+    const auto statistics = chunk.get_statistics(_column_id);
+    if (!statistics) return false;
+
+    if (_lower_bound && opossum::can_prune(*statistics,
+                                           _lower_bound_is_inclusive ? ScanType::OpGreaterThanEquals
+                                                                     : ScanType::OpGreaterThan,
+                                           *_lower_bound)) {
+      return true;
+    }
+    if (_upper_bound && opossum::can_prune(*statistics,
+                                           _upper_bound_is_inclusive ? ScanType::OpLessThanEquals
+                                                                     : ScanType::OpLessThan,
+                                           *_upper_bound)) {
+      return true;
+    }
+    return std::any_of(_excluded_values.cbegin(), _excluded_values.cend(), [&](const T& excluded_value) {
+      return opossum::can_prune(*statistics, ScanType::OpNotEquals, excluded_value);
+    });
+  }
+
+  double estimate_selectivity(const Chunk& chunk) const override {
+    const auto segment = chunk.get_segment(_column_id);
+
+    // Every value of the dictionary is assumed to occur equally often
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      const auto [begin, end] = _value_id_range(*dictionary_segment);
+      if (begin >= end) return 0.0;
+      const auto value_id_count = end - begin - _excluded_value_ids(*dictionary_segment, begin, end).size();
+      return static_cast<double>(value_id_count) / static_cast<double>(dictionary_segment->dictionary()->size());
+    }
+
+    // Numbers are assumed to be spread evenly between the minimum and the maximum of the chunk
+    if constexpr (std::is_arithmetic_v<T>) {
+      if (const auto statistics = chunk.get_statistics(_column_id)) {
+        const auto min = static_cast<double>(type_cast<T>(statistics->min));
+        const auto max = static_cast<double>(type_cast<T>(statistics->max));
+        if (min == max) return 1.0;
+        const auto lower_bound = _lower_bound ? std::max(static_cast<double>(*_lower_bound), min) : min;
+        const auto upper_bound = _upper_bound ? std::min(static_cast<double>(*_upper_bound), max) : max;
+        return std::clamp((upper_bound - lower_bound) / (max - min), 0.0, 1.0);
+      }
+    }
+
+    // Without any information about the values, equality is assumed to be the most selective predicate
+    if (_lower_bound && _upper_bound && *_lower_bound == *_upper_bound) return 0.1;
+    return (_lower_bound ? 0.5 : 1.0) * (_upper_bound ? 0.5 : 1.0) * (_excluded_values.empty() ? 1.0 : 0.9);
+  }
+
+  void scan(const Chunk& chunk, std::vector<uint8_t>& matches) const override {
+    resolve_segment_type<T>(*chunk.get_segment(_column_id), [&](const auto& segment) {
+      using SegmentType = std::decay_t<decltype(segment)>;
+
+      if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+        _scan_dictionary_segment(segment, matches);
+      } else if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+        const auto& values = segment.values();
+        // Blocks of which no row matches anymore are skipped
+        for_each_block_containing(matches, 1, [&](const size_t block_begin, const size_t block_end) {
+          for (auto row_id = block_begin; row_id < block_end; ++row_id) {
+            matches[row_id] &= _matches(values[row_id]);
+          }
+        });
+      } else {
+        // The remaining encodings and ReferenceSegments are only read through segment_iterate
+        segment_iterate<T>(segment, [&](const auto& position) {
+          auto& match = matches[position.chunk_offset()];
+          if (match) match = !position.is_null() && _matches(position.value());
+        });
+      }
+    });
+  }
+
+ protected:
+  void _restrict_lower_bound(const T& value, const bool is_inclusive) {
+    if (!_lower_bound || *_lower_bound < value || (*_lower_bound == value && !is_inclusive)) {
+      _lower_bound = value;
+      _lower_bound_is_inclusive = is_inclusive;
+    }
+  }
+
+  void _restrict_upper_bound(const T& value, const bool is_inclusive) {
+    if (!_upper_bound || value < *_upper_bound || (*_upper_bound == value && !is_inclusive)) {
+      _upper_bound = value;
+      _upper_bound_is_inclusive = is_inclusive;
+    }
+  }
+
+  template <typename V>
+  bool _matches(const V& value) const {
+    if (_lower_bound && (value < *_lower_bound || (!_lower_bound_is_inclusive && value == *_lower_bound))) {
+      return false;
+    }
+    if (_upper_bound && (*_upper_bound < value || (!_upper_bound_is_inclusive && value == *_upper_bound))) {
+      return false;
+    }
+    return std::none_of(_excluded_values.cbegin(), _excluded_values.cend(),
+                        [&](const T& excluded_value) { return value == excluded_value; });
+  }
+
+  // returns the ValueIDs [begin, end) whose values lie between the bounds
+  std::pair<ValueID::base_type, ValueID::base_type> _value_id_range(const DictionarySegment<T>& segment) const {
+    const auto dictionary_size = static_cast<ValueID::base_type>(segment.dictionary()->size());
+    const auto value_id_or_end = [&](const ValueID value_id) {
+      return value_id == INVALID_VALUE_ID ? dictionary_size : static_cast<ValueID::base_type>(value_id);
+    };
+
+    auto begin = ValueID::base_type{0};
+    auto end = dictionary_size;
+    if (_lower_bound) {
+      begin = value_id_or_end(_lower_bound_is_inclusive ? segment.lower_bound(*_lower_bound)
+                                                        : segment.upper_bound(*_lower_bound));
+    }
+    if (_upper_bound) {
+      end = value_id_or_end(_upper_bound_is_inclusive ? segment.upper_bound(*_upper_bound)
+                                                      : segment.lower_bound(*_upper_bound));
+    }
+    return {begin, end};
+  }
+
+  // returns the ValueIDs in [begin, end) of the values excluded by OpNotEquals
+  std::vector<ValueID::base_type> _excluded_value_ids(const DictionarySegment<T>& segment,
+                                                      const ValueID::base_type begin,
+                                                      const ValueID::base_type end) const {
+    const auto& dictionary = *segment.dictionary();
+    std::vector<ValueID::base_type> excluded_value_ids;
+    for (const auto& excluded_value : _excluded_values) {
+      const auto value_id = segment.lower_bound(excluded_value);
+      if (value_id == INVALID_VALUE_ID || value_id < begin || value_id >= end) continue;
+      if (dictionary[value_id] != excluded_value) continue;
+      if (std::find(excluded_value_ids.cbegin(), excluded_value_ids.cend(), value_id) != excluded_value_ids.cend()) {
+        continue;
+      }
+      excluded_value_ids.emplace_back(value_id);
+    }
+    return excluded_value_ids;
+  }
+
+  // The bounds are translated into a range of ValueIDs, so each row takes a single comparison of its ValueID. Values
+  // excluded by OpNotEquals take one more comparison each.
+  void _scan_dictionary_segment(const DictionarySegment<T>& segment, std::vector<uint8_t>& matches) const {
+    const auto [begin, end] = _value_id_range(segment);
+    if (begin >= end) {
+      std::fill(matches.begin(), matches.end(), uint8_t{0});
+      return;
+    }
+
+    const auto excluded_value_ids = _excluded_value_ids(segment, begin, end);
+    const auto range_size = end - begin;
+    if (range_size == segment.dictionary()->size() && excluded_value_ids.empty()) return;
+
+    // ValueIDs below begin wrap around to large numbers, so the range check is a single unsigned comparison
+    const auto scan_value_ids = [&](const auto& value_ids, const size_t first_row_id, const size_t block_begin,
+                                    const size_t block_end) {
+      for (auto row_id = block_begin; row_id < block_end; ++row_id) {
+        const auto value_id = static_cast<ValueID::base_type>(value_ids[row_id - first_row_id]);
+        auto match = static_cast<ValueID::base_type>(value_id - begin) < range_size;
+        for (const auto excluded_value_id : excluded_value_ids) {
+          match &= value_id != excluded_value_id;
+        }
+        matches[row_id] &= match;
+      }
+    };
+
+    for_each_value_id_block(*segment.attribute_vector(), matches, 1, scan_value_ids);
+  }
+
+  const ColumnID _column_id;
+
+  std::optional<T> _lower_bound;
+  bool _lower_bound_is_inclusive{false};
+  std::optional<T> _upper_bound;
+  bool _upper_bound_is_inclusive{false};
+  std::vector<T> _excluded_values;
+};
+
+}  // namespace
+
+std::vector<ScanPredicate> between_predicates(const ColumnID column_id, const AllTypeVariant& lower_value,
+                                              const AllTypeVariant& upper_value) {
+  return {{column_id, ScanType::OpGreaterThanEquals, lower_value},
+          {column_id, ScanType::OpLessThanEquals, upper_value}};
+}
+
+ConjunctiveTableScan::ConjunctiveTableScan(const std::shared_ptr<const AbstractOperator> in,
+                                           const std::vector<ScanPredicate>& predicates)
+    : AbstractOperator(in), _predicates(predicates) {
+  Assert(!_predicates.empty(), "ConjunctiveTableScan requires at least one predicate");
+}
+
+const std::string ConjunctiveTableScan::name() const { return "ConjunctiveTableScan"; }
+
+const std::vector<ScanPredicate>& ConjunctiveTableScan::predicates() const { return _predicates; }
+
+size_t ConjunctiveTableScan::pruned_chunk_count() const { return _pruned_chunk_count; }
+
+std::shared_ptr<const Table> ConjunctiveTableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  std::vector<std::unique_ptr<BaseColumnPredicates>> column_predicates;
+  for (const auto& [column_id, predicates] : group_predicates_by_column(_predicates)) {
+    column_predicates.emplace_back(make_unique_by_data_type<BaseColumnPredicates, ColumnPredicates>(
+        input_table->column_type(column_id), column_id, predicates));
+  }
+
+  // Every chunk is scanned by its own job into its own PosList, like in TableScan. Pruned and empty chunks keep a
+  // nullptr.
+  std::vector<std::shared_ptr<PosList>> pos_lists(chunk_count);
+  size_t pruned_chunk_count = 0;
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    if (std::any_of(column_predicates.cbegin(), column_predicates.cend(),
+                    [&](const auto& predicates) { return predicates->can_prune(chunk); })) {
+      ++pruned_chunk_count;
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+
+      // The most selective column comes first, so that the following ones can skip more blocks
+      std::vector<std::pair<double, size_t>> scan_order;
+      for (size_t column_index = 0; column_index < column_predicates.size(); ++column_index) {
+        scan_order.emplace_back(column_predicates[column_index]->estimate_selectivity(chunk), column_index);
+      }
+      std::stable_sort(scan_order.begin(), scan_order.end(),
+                       [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+      std::vector<uint8_t> matches(chunk.size(), 1);
+      for (const auto& [selectivity, column_index] : scan_order) {
+        column_predicates[column_index]->scan(chunk, matches);
+      }
+
+      pos_lists[chunk_id] = matches_to_pos_list(matches, chunk_id);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  _pruned_chunk_count = pruned_chunk_count;
+
+  return create_reference_output_table(input_table, pos_lists);
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// A predicate "column <scan_type> search_value" of a ConjunctiveTableScan
+struct ScanPredicate {
+  ColumnID column_id;
+  ScanType scan_type;
+  AllTypeVariant search_value;
+};
+
+// Returns the predicates of "column BETWEEN lower_value AND upper_value", which includes both bounds
+std::vector<ScanPredicate> between_predicates(const ColumnID column_id, const AllTypeVariant& lower_value,
+                                              const AllTypeVariant& upper_value);
+
+// Selects the rows that fulfill all of the predicates, e.g., a > 5 AND a < 10 AND b = 'x', in a single pass per chunk.
+// Chaining one TableScan per predicate instead would create a PosList per predicate and resolve the references of the
+// previous scan each time. The output consists of ReferenceSegments, like that of TableScan. NULLs never match.
+//
+// The predicates on the same column are combined into a range of values plus the values excluded by OpNotEquals. On a
+// DictionarySegment, the range is translated into a range of ValueIDs, so that, e.g., a BETWEEN is a single range
+// check per row. Each chunk is scanned by its own job, which keeps one byte per row that tells whether the row still
+// matches. The columns are scanned in the order of their estimated selectivity in the chunk, most selective first, and
+// blocks of rows of which none matches anymore are skipped. Chunks whose min/max statistics rule out the predicates of
+// a column are not scanned at all.
+class ConjunctiveTableScan : public AbstractOperator {
+ public:
+  ConjunctiveTableScan(const std::shared_ptr<const AbstractOperator> in, const std::vector<ScanPredicate>& predicates);
+
+  const std::string name() const override;
+
+  const std::vector<ScanPredicate>& predicates() const;
+
+  // returns the number of input chunks that were skipped based on their min/max statistics
+  size_t pruned_chunk_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<ScanPredicate> _predicates;
+  size_t _pruned_chunk_count{0};
+};
+
+}  // namespace opossum
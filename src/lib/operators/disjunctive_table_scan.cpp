@@ -0,0 +1,257 @@
+#include "disjunctive_table_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "operator_utils.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "table_scan_impl.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// All predicates of a DisjunctiveTableScan on one column
+class BaseColumnDisjunction {
+ public:
+  virtual ~BaseColumnDisjunction() = default;
+
+  // returns whether no row of the chunk can fulfill any of the predicates, based on the chunk's min/max statistics
+  virtual bool can_prune(const Chunk& chunk) const = 0;
+
+  // sets the matches of the rows of the chunk that fulfill any of the predicates
+  virtual void scan(const Chunk& chunk, std::vector<uint8_t>& matches) const = 0;
+};
+
+template <typename T>
+class ColumnDisjunction : public BaseColumnDisjunction {
+ public:
+  ColumnDisjunction(const ColumnID column_id, const std::vector<ScanPredicate>& predicates) : _column_id(column_id) {
+    for (const auto& predicate : predicates) {
+      if (predicate.scan_type == ScanType::OpEquals) {
+        _equal_values.emplace_back(type_cast<T>(predicate.search_value));
+      } else {
+        _other_predicates.emplace_back(predicate.scan_type, type_cast<T>(predicate.search_value));
+      }
+    }
+    std::sort(_equal_values.begin(), _equal_values.end());
+    _equal_values.erase(std::unique(_equal_values.begin(), _equal_values.end()), _equal_values.end());
+  }
+
+  bool can_prune(const Chunk& chunk) const override {
+    const auto statistics = chunk.get_statistics(_column_id);
+    if (!statistics) return false;
+
+    // The values are sorted, so the first value that is not below the minimum tells whether any of them is in range
+    const auto min = type_cast<T>(statistics->min);
+    const auto max = type_cast<T>(statistics->max);
+    const auto equal_value = std::lower_bound(_equal_values.cbegin(), _equal_values.cend(), min);
+    if (equal_value != _equal_values.cend() && !(max < *equal_value)) return false;
+
+    return std::all_of(_other_predicates.cbegin(), _other_predicates.cend(), [&](const auto& predicate) {
+      return opossum::can_prune(*statistics, predicate.first, predicate.second);
+    });
+  }
+
+  void scan(const Chunk& chunk, std::vector<uint8_t>& matches) const override {
+    resolve_segment_type<T>(*chunk.get_segment(_column_id), [&](const auto& segment) {
+      using SegmentType = std::decay_t<decltype(segment)>;
+
+      if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+        _scan_dictionary_segment(segment, matches);
+      } else if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+        const auto& values = segment.values();
+        // Blocks of which all rows match already are skipped
+        for_each_block_containing(matches, 0, [&](const size_t block_begin, const size_t block_end) {
+          for (auto row_id = block_begin; row_id < block_end; ++row_id) {
+            matches[row_id] |= _matches(values[row_id]);
+          }
+        });
+      } else {
+        // The remaining encodings and ReferenceSegments are only read through segment_iterate
+        segment_iterate<T>(segment, [&](const auto& position) {
+          auto& match = matches[position.chunk_offset()];
+          if (!match) match = !position.is_null() && _matches(position.value());
+        });
+      }
+    });
+  }
+
+ protected:
+  template <typename V>
+  bool _matches(const V& value) const {
+    if (std::binary_search(_equal_values.cbegin(), _equal_values.cend(), value)) return true;
+    return std::any_of(_other_predicates.cbegin(), _other_predicates.cend(), [&](const auto& predicate) {
+      auto result = false;
+      with_comparator(predicate.first, [&](const auto compare) { result = compare(value, predicate.second); });
+      return result;
+    });
+  }
+
+  // Returns one byte per ValueID of the dictionary that tells whether its value fulfills any of the predicates
+  std::vector<uint8_t> _value_id_bitmap(const DictionarySegment<T>& segment) const {
+    const auto& dictionary = *segment.dictionary();
+    const auto dictionary_size = dictionary.size();
+    std::vector<uint8_t> bitmap(dictionary_size, 0);
+
+    // Both the values and the dictionary are sorted, so each search continues where the previous one stopped
+    auto search_begin = dictionary.cbegin();
+    for (const auto& value : _equal_values) {
+      search_begin = std::lower_bound(search_begin, dictionary.cend(), value);
+      if (search_begin == dictionary.cend()) break;
+      if (*search_begin == value) bitmap[std::distance(dictionary.cbegin(), search_begin)] = 1;
+    }
+
+    const auto value_id_or_end = [&](const ValueID value_id) {
+      return value_id == INVALID_VALUE_ID ? dictionary_size : static_cast<size_t>(value_id);
+    };
+    const auto mark_range = [&](const size_t begin, const size_t end) {
+      std::fill(bitmap.begin() + begin, bitmap.begin() + std::max(begin, end), uint8_t{1});
+    };
+
+    for (const auto& [scan_type, search_value] : _other_predicates) {
+      switch (scan_type) {
+        case ScanType::OpNotEquals: {
+          const auto value_id = segment.lower_bound(search_value);
+          mark_range(0, dictionary_size);
+          if (value_id != INVALID_VALUE_ID && dictionary[value_id] == search_value) {
+            // The value is only excluded if no other predicate marked it
+            auto other_predicates_match = std::binary_search(_equal_values.cbegin(), _equal_values.cend(),
+                                                             search_value);
+            for (const auto& [other_scan_type, other_search_value] : _other_predicates) {
+              with_comparator(other_scan_type, [&](const auto compare) {
+                other_predicates_match |= compare(search_value, other_search_value);
+              });
+            }
+            bitmap[value_id] = other_predicates_match;
+          }
+          break;
+        }
+        case ScanType::OpLessThan:
+          mark_range(0, value_id_or_end(segment.lower_bound(search_value)));
+          break;
+        case ScanType::OpLessThanEquals:
+          mark_range(0, value_id_or_end(segment.upper_bound(search_value)));
+          break;
+        case ScanType::OpGreaterThan:
+          mark_range(value_id_or_end(segment.upper_bound(search_value)), dictionary_size);
+          break;
+        case ScanType::OpGreaterThanEquals:
+          mark_range(value_id_or_end(segment.lower_bound(search_value)), dictionary_size);
+          break;
+        case ScanType::OpEquals:
+          Fail("OpEquals predicates are part of the equal values");
+      }
+    }
+    return bitmap;
+  }
+
+  // The predicates are translated into a bitmap over the ValueIDs, so each row takes a single lookup of its ValueID,
+  // however many values an IN-list has
+  void _scan_dictionary_segment(const DictionarySegment<T>& segment, std::vector<uint8_t>& matches) const {
+    const auto bitmap = _value_id_bitmap(segment);
+    const auto matching_value_id_count = std::count(bitmap.cbegin(), bitmap.cend(), uint8_t{1});
+    if (matching_value_id_count == 0) return;
+    if (static_cast<size_t>(matching_value_id_count) == bitmap.size()) {
+      std::fill(matches.begin(), matches.end(), uint8_t{1});
+      return;
+    }
+
+    const auto scan_value_ids = [&](const auto& value_ids, const size_t first_row_id, const size_t block_begin,
+                                    const size_t block_end) {
+      for (auto row_id = block_begin; row_id < block_end; ++row_id) {
+        matches[row_id] |= bitmap[value_ids[row_id - first_row_id]];
+      }
+    };
+
+    for_each_value_id_block(*segment.attribute_vector(), matches, 0, scan_value_ids);
+  }
+
+  const ColumnID _column_id;
+
+  // sorted and without duplicates
+  std::vector<T> _equal_values;
+  std::vector<std::pair<ScanType, T>> _other_predicates;
+};
+
+}  // namespace
+
+std::vector<ScanPredicate> in_predicates(const ColumnID column_id, const std::vector<AllTypeVariant>& values) {
+  std::vector<ScanPredicate> predicates;
+  predicates.reserve(values.size());
+  for (const auto& value : values) {
+    predicates.push_back({column_id, ScanType::OpEquals, value});
+  }
+  return predicates;
+}
+
+DisjunctiveTableScan::DisjunctiveTableScan(const std::shared_ptr<const AbstractOperator> in,
+                                           const std::vector<ScanPredicate>& predicates)
+    : AbstractOperator(in), _predicates(predicates) {
+  Assert(!_predicates.empty(), "DisjunctiveTableScan requires at least one predicate");
+}
+
+const std::string DisjunctiveTableScan::name() const { return "DisjunctiveTableScan"; }
+
+const std::vector<ScanPredicate>& DisjunctiveTableScan::predicates() const { return _predicates; }
+
+size_t DisjunctiveTableScan::pruned_chunk_count() const { return _pruned_chunk_count; }
+
+std::shared_ptr<const Table> DisjunctiveTableScan::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  std::vector<std::unique_ptr<BaseColumnDisjunction>> column_disjunctions;
+  for (const auto& [column_id, predicates] : group_predicates_by_column(_predicates)) {
+    column_disjunctions.emplace_back(make_unique_by_data_type<BaseColumnDisjunction, ColumnDisjunction>(
+        input_table->column_type(column_id), column_id, predicates));
+  }
+
+  // Every chunk is scanned by its own job into its own PosList, like in TableScan. Pruned and empty chunks keep a
+  // nullptr.
+  std::vector<std::shared_ptr<PosList>> pos_lists(chunk_count);
+  size_t pruned_chunk_count = 0;
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = input_table->get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    if (std::all_of(column_disjunctions.cbegin(), column_disjunctions.cend(),
+                    [&](const auto& disjunction) { return disjunction->can_prune(chunk); })) {
+      ++pruned_chunk_count;
+      continue;
+    }
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+
+      // The matches of the columns are combined in a single bitmap, one byte per row
+      std::vector<uint8_t> matches(chunk.size(), 0);
+      for (const auto& disjunction : column_disjunctions) {
+        if (!disjunction->can_prune(chunk)) disjunction->scan(chunk, matches);
+      }
+
+      pos_lists[chunk_id] = matches_to_pos_list(matches, chunk_id);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  _pruned_chunk_count = pruned_chunk_count;
+
+  return create_reference_output_table(input_table, pos_lists);
+}
+
+}  // namespace opossum
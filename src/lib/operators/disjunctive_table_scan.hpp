@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "all_type_variant.hpp"
+#include "conjunctive_table_scan.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Returns the predicates of "column IN (values)", i.e., one OpEquals predicate per value
+std::vector<ScanPredicate> in_predicates(const ColumnID column_id, const std::vector<AllTypeVariant>& values);
+
+// Selects the rows that fulfill at least one of the predicates, e.g., a IN (1, 5, 7) OR b < 3, in a single pass per
+// chunk. The output consists of ReferenceSegments, like that of TableScan. NULLs never match.
+//
+// The OpEquals predicates on the same column form a sorted list of values, so that IN-lists with thousands of values
+// take a binary search per row instead of one comparison per value. On a DictionarySegment, all predicates on the
+// column are translated into a bitmap over the ValueIDs of the dictionary, which takes one lookup per row. Each chunk
+// is scanned by its own job, which keeps one byte per row that tells whether the row matches any of the columns
+// scanned so far. Blocks of rows that all match already are skipped by the following columns. A chunk is only skipped
+// if its min/max statistics rule out the predicates of all columns.
+class DisjunctiveTableScan : public AbstractOperator {
+ public:
+  DisjunctiveTableScan(const std::shared_ptr<const AbstractOperator> in, const std::vector<ScanPredicate>& predicates);
+
+  const std::string name() const override;
+
+  const std::vector<ScanPredicate>& predicates() const;
+
+  // returns the number of input chunks that were skipped based on their min/max statistics
+  size_t pruned_chunk_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<ScanPredicate> _predicates;
+  size_t _pruned_chunk_count{0};
+};
+
+}  // namespace opossum
@@ -9,4 +9,9 @@ GetTable::GetTable(const std::string& name) : _table_name(name) {}
 const std::string& GetTable::table_name() const { return _table_name; }
 
 std::shared_ptr<const Table> GetTable::_on_execute() { return StorageManager::get().get_table(_table_name); }
+
+bool GetTable::_creates_output() const { return false; }
+
+const std::string GetTable::name() const { return "GetTable"; }
+
 }  // namespace opossum
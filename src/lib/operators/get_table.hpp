@@ -13,10 +13,13 @@ class GetTable : public AbstractOperator {
  public:
   explicit GetTable(const std::string& name);
 
+  const std::string name() const override;
+
   const std::string& table_name() const;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
+  bool _creates_output() const override;
 
   std::string _table_name;
 };
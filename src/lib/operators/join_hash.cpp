@@ -0,0 +1,408 @@
+#include "join_hash.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "operator_utils.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The matching positions of the probe and of the build input that make up one output chunk
+using ProbeAndBuildPosLists = std::pair<std::shared_ptr<PosList>, std::shared_ptr<PosList>>;
+
+// Adds the output rows for a row of the probe input, given the positions of its join partners in the build input, or
+// nullptr if it has none
+void emit_matches(const JoinMode mode, const RowID probe_row_id, const PosList* matches, PosList& probe_pos_list,
+                  PosList& build_pos_list) {
+  if (!matches) {
+    if (mode == JoinMode::Left) {
+      probe_pos_list.emplace_back(probe_row_id);
+      build_pos_list.emplace_back(NULL_ROW_ID);
+    }
+    return;
+  }
+
+  if (mode == JoinMode::Semi) {
+    probe_pos_list.emplace_back(probe_row_id);
+    return;
+  }
+
+  for (const auto& build_row_id : *matches) {
+    probe_pos_list.emplace_back(probe_row_id);
+    build_pos_list.emplace_back(build_row_id);
+  }
+}
+
+template <typename T>
+std::vector<ProbeAndBuildPosLists> join_unpartitioned(const Table& build_table, const ColumnID build_column_id,
+                                                      const Table& probe_table, const ColumnID probe_column_id,
+                                                      const JoinMode mode) {
+  // Build phase. Maps each value of the build input to the positions where it occurs. Strings are used as string_views
+  // into build_strings, which holds a copy of each distinct build string. This keeps the keys valid even if a segment
+  // of the build input is replaced, e.g., by the ChunkCompressionService, and probing does not copy any string.
+  using HashKey = SegmentValueType<T>;
+  std::unordered_map<HashKey, PosList> hash_table;
+  std::deque<std::string> build_strings;
+
+  for (ChunkID chunk_id{0}; chunk_id < build_table.chunk_count(); ++chunk_id) {
+    const auto& chunk = build_table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    segment_iterate<T>(*chunk.get_segment(build_column_id), [&](const auto& position) {
+      if (position.is_null()) return;
+
+      auto entry = hash_table.find(position.value());
+      if (entry == hash_table.end()) {
+        if constexpr (std::is_same_v<T, std::string>) {
+          const auto& build_string = build_strings.emplace_back(position.value());
+          entry = hash_table.emplace(HashKey{build_string}, PosList{}).first;
+        } else {
+          entry = hash_table.emplace(position.value(), PosList{}).first;
+        }
+      }
+      entry->second.emplace_back(RowID{chunk_id, position.chunk_offset()});
+    });
+  }
+
+  // Probe phase. Each probe chunk is handled by its own job, which writes the matching positions of both inputs
+  // into its own PosLists.
+  const auto probe_chunk_count = probe_table.chunk_count();
+  std::vector<ProbeAndBuildPosLists> chunk_pos_lists(probe_chunk_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < probe_chunk_count; ++chunk_id) {
+    if (probe_table.get_chunk(chunk_id).size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto probe_pos_list = std::make_shared<PosList>();
+      auto build_pos_list = std::make_shared<PosList>();
+
+      const auto segment = probe_table.get_chunk(chunk_id).get_segment(probe_column_id);
+      segment_iterate<T>(*segment, [&](const auto& position) {
+        const auto match = position.is_null() ? hash_table.end() : hash_table.find(position.value());
+        emit_matches(mode, RowID{chunk_id, position.chunk_offset()},
+                     match == hash_table.end() ? nullptr : &match->second, *probe_pos_list, *build_pos_list);
+      });
+
+      chunk_pos_lists[chunk_id] = {std::move(probe_pos_list), std::move(build_pos_list)};
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return chunk_pos_lists;
+}
+
+// A materialized value of the join column, together with its hash and its position in the input
+template <typename T>
+struct RadixPartitionedValue {
+  size_t hash;
+  RowID row_id;
+  SegmentValueType<T> value;
+};
+
+template <typename T>
+struct RadixPartitions {
+  std::vector<RadixPartitionedValue<T>> values;
+
+  // partition i consists of values[offsets[i]] to values[offsets[i + 1] - 1]
+  std::vector<size_t> offsets;
+
+  // the positions whose value is NULL, which are not part of any partition because they never find a join partner
+  PosList null_row_ids;
+
+  // the segments that string values point into, see collect_value_segments()
+  std::vector<std::shared_ptr<const BaseSegment>> segments;
+};
+
+// Fibonacci hashing spreads the hash over all bits, so that the partitions are balanced even if std::hash is the
+// identity, as it is for integers in libstdc++, and the values only differ in their lower bits
+template <typename V>
+size_t radix_hash(const V& value) {
+  return std::hash<V>{}(value) * size_t{0x9E3779B97F4A7C15};
+}
+
+// Returns the partition of a hash within a pass of the radix partitioning, i.e., the bits bits below the highest
+// consumed_bits bits of the hash. bits has to be greater than 0.
+size_t radix_of(const size_t hash, const uint8_t consumed_bits, const uint8_t bits) {
+  return (hash << consumed_bits) >> (std::numeric_limits<size_t>::digits - bits);
+}
+
+// Materializes the join column of a table and partitions its values by the highest radix_bits bits of their hashes
+template <typename T>
+RadixPartitions<T> radix_partition(const Table& table, const ColumnID column_id, const uint8_t radix_bits) {
+  RadixPartitions<T> partitions;
+  if constexpr (std::is_same_v<T, std::string>) {
+    partitions.segments = collect_value_segments(table, column_id);
+  }
+
+  // First pass. Each job materializes one chunk and counts how many of its values belong to each partition.
+  const auto chunk_count = table.chunk_count();
+  const auto first_pass_bits = std::min(radix_bits, JoinHash::RADIX_BITS_PER_PASS);
+  const auto first_pass_fan_out = size_t{1} << first_pass_bits;
+  std::vector<std::vector<RadixPartitionedValue<T>>> chunk_values(chunk_count);
+  std::vector<std::vector<size_t>> histograms(chunk_count, std::vector<size_t>(first_pass_fan_out));
+  std::vector<PosList> chunk_null_row_ids(chunk_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& values = chunk_values[chunk_id];
+      auto& histogram = histograms[chunk_id];
+      const auto segment = table.get_chunk(chunk_id).get_segment(column_id);
+      values.reserve(segment->size());
+
+      segment_iterate<T>(*segment, [&](const auto& position) {
+        const auto row_id = RowID{chunk_id, position.chunk_offset()};
+        if (position.is_null()) {
+          chunk_null_row_ids[chunk_id].emplace_back(row_id);
+          return;
+        }
+
+        const auto hash = radix_hash(position.value());
+        ++histogram[radix_of(hash, 0, first_pass_bits)];
+        values.emplace_back(RadixPartitionedValue<T>{hash, row_id, position.value()});
+      });
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // Within each partition, the values of a chunk are written behind those of the previous chunks. The histograms are
+  // turned into the positions at which each chunk writes its next value of a partition.
+  partitions.offsets.resize(first_pass_fan_out + 1);
+  auto value_count = size_t{0};
+  for (size_t partition = 0; partition < first_pass_fan_out; ++partition) {
+    partitions.offsets[partition] = value_count;
+    for (auto& histogram : histograms) {
+      const auto partition_value_count = histogram[partition];
+      histogram[partition] = value_count;
+      value_count += partition_value_count;
+    }
+  }
+  partitions.offsets.back() = value_count;
+
+  for (const auto& null_row_ids : chunk_null_row_ids) {
+    partitions.null_row_ids.insert(partitions.null_row_ids.end(), null_row_ids.cbegin(), null_row_ids.cend());
+  }
+
+  auto& values = partitions.values;
+  values.resize(value_count);
+  jobs.clear();
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (chunk_values[chunk_id].empty()) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& write_positions = histograms[chunk_id];
+      for (const auto& value : chunk_values[chunk_id]) {
+        values[write_positions[radix_of(value.hash, 0, first_pass_bits)]++] = value;
+      }
+      chunk_values[chunk_id] = {};
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // Further passes. Each job splits one partition of the previous pass into sub-partitions by the next bits of the
+  // hashes. The sub-partitions of a partition are stored in its place, so partition p of the previous pass becomes the
+  // partitions p * fan_out to (p + 1) * fan_out - 1.
+  auto consumed_bits = first_pass_bits;
+  std::vector<RadixPartitionedValue<T>> pass_values;
+  while (consumed_bits < radix_bits) {
+    const auto pass_bits = std::min(static_cast<uint8_t>(radix_bits - consumed_bits), JoinHash::RADIX_BITS_PER_PASS);
+    const auto fan_out = size_t{1} << pass_bits;
+    const auto previous_partition_count = partitions.offsets.size() - 1;
+    std::vector<size_t> pass_offsets(previous_partition_count * fan_out + 1);
+    pass_offsets.back() = value_count;
+    pass_values.resize(value_count);
+
+    jobs.clear();
+    for (size_t previous_partition = 0; previous_partition < previous_partition_count; ++previous_partition) {
+      const auto begin = partitions.offsets[previous_partition];
+      const auto end = partitions.offsets[previous_partition + 1];
+      if (begin == end) {
+        std::fill_n(pass_offsets.begin() + previous_partition * fan_out, fan_out, begin);
+        continue;
+      }
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, previous_partition, begin, end]() {
+        std::vector<size_t> write_positions(fan_out);
+        for (auto index = begin; index < end; ++index) {
+          ++write_positions[radix_of(values[index].hash, consumed_bits, pass_bits)];
+        }
+
+        auto position = begin;
+        for (size_t partition = 0; partition < fan_out; ++partition) {
+          pass_offsets[previous_partition * fan_out + partition] = position;
+          const auto partition_value_count = write_positions[partition];
+          write_positions[partition] = position;
+          position += partition_value_count;
+        }
+
+        for (auto index = begin; index < end; ++index) {
+          pass_values[write_positions[radix_of(values[index].hash, consumed_bits, pass_bits)]++] = values[index];
+        }
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+    std::swap(values, pass_values);
+    partitions.offsets = std::move(pass_offsets);
+    consumed_bits += pass_bits;
+  }
+
+  return partitions;
+}
+
+template <typename T>
+std::vector<ProbeAndBuildPosLists> join_radix_partitioned(const Table& build_table, const ColumnID build_column_id,
+                                                          const Table& probe_table, const ColumnID probe_column_id,
+                                                          const JoinMode mode, const uint8_t radix_bits) {
+  // The inputs are partitioned one after the other, so that each of them is partitioned using all workers
+  const auto build_partitions = radix_partition<T>(build_table, build_column_id, radix_bits);
+  const auto probe_partitions = radix_partition<T>(probe_table, probe_column_id, radix_bits);
+
+  // Each pair of build and probe partition is joined by its own job. As all values of a partition are materialized,
+  // the hash table can use them as keys without copying strings.
+  const auto partition_count = size_t{1} << radix_bits;
+  std::vector<ProbeAndBuildPosLists> partition_pos_lists(partition_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (size_t partition = 0; partition < partition_count; ++partition) {
+    const auto build_begin = build_partitions.offsets[partition];
+    const auto build_end = build_partitions.offsets[partition + 1];
+    const auto probe_begin = probe_partitions.offsets[partition];
+    const auto probe_end = probe_partitions.offsets[partition + 1];
+    if (probe_begin == probe_end || (build_begin == build_end && mode != JoinMode::Left)) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition, build_begin, build_end, probe_begin, probe_end]() {
+      std::unordered_map<SegmentValueType<T>, PosList> hash_table;
+      hash_table.reserve(build_end - build_begin);
+      for (auto index = build_begin; index < build_end; ++index) {
+        const auto& build_value = build_partitions.values[index];
+        hash_table[build_value.value].emplace_back(build_value.row_id);
+      }
+
+      auto probe_pos_list = std::make_shared<PosList>();
+      auto build_pos_list = std::make_shared<PosList>();
+      for (auto index = probe_begin; index < probe_end; ++index) {
+        const auto& probe_value = probe_partitions.values[index];
+        const auto match = hash_table.find(probe_value.value);
+        emit_matches(mode, probe_value.row_id, match == hash_table.end() ? nullptr : &match->second, *probe_pos_list,
+                     *build_pos_list);
+      }
+
+      partition_pos_lists[partition] = {std::move(probe_pos_list), std::move(build_pos_list)};
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // NULLs are not part of any partition, but left joins emit them without join partner
+  if (mode == JoinMode::Left && !probe_partitions.null_row_ids.empty()) {
+    const auto& null_row_ids = probe_partitions.null_row_ids;
+    partition_pos_lists.emplace_back(std::make_shared<PosList>(null_row_ids),
+                                     std::make_shared<PosList>(null_row_ids.size(), NULL_ROW_ID));
+  }
+
+  // Most partitions are much smaller than a chunk, so consecutive partitions are combined into output chunks that
+  // have about the average size of the probe chunks
+  const auto probe_chunk_count = std::max(size_t{1}, static_cast<size_t>(probe_table.chunk_count()));
+  const auto output_chunk_size = std::max(size_t{1}, static_cast<size_t>(probe_table.row_count()) / probe_chunk_count);
+  std::vector<ProbeAndBuildPosLists> chunk_pos_lists;
+  for (const auto& [probe_pos_list, build_pos_list] : partition_pos_lists) {
+    if (!probe_pos_list || probe_pos_list->empty()) continue;
+
+    if (chunk_pos_lists.empty() || chunk_pos_lists.back().first->size() >= output_chunk_size) {
+      chunk_pos_lists.emplace_back(std::make_shared<PosList>(), std::make_shared<PosList>());
+      chunk_pos_lists.back().first->reserve(output_chunk_size);
+    }
+    auto& [chunk_probe_pos_list, chunk_build_pos_list] = chunk_pos_lists.back();
+    chunk_probe_pos_list->insert(chunk_probe_pos_list->end(), probe_pos_list->cbegin(), probe_pos_list->cend());
+    chunk_build_pos_list->insert(chunk_build_pos_list->end(), build_pos_list->cbegin(), build_pos_list->cend());
+  }
+
+  return chunk_pos_lists;
+}
+
+}  // namespace
+
+JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
+                   const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                   const std::pair<ColumnID, ColumnID>& column_ids, const std::optional<uint8_t> radix_bits)
+    : AbstractJoinOperator(left, right, mode, column_ids, ScanType::OpEquals), _radix_bits(radix_bits) {
+  Assert(!radix_bits || *radix_bits <= MAX_RADIX_BITS, "Too many radix bits");
+}
+
+const std::string JoinHash::name() const { return "JoinHash"; }
+
+const std::optional<uint8_t>& JoinHash::radix_bits() const { return _radix_bits; }
+
+uint8_t JoinHash::default_radix_bits(const size_t build_row_count) {
+  auto radix_bits = uint8_t{0};
+  while (radix_bits < MAX_RADIX_BITS && build_row_count > (JOIN_HASH_PARTITION_ROW_COUNT << radix_bits)) {
+    ++radix_bits;
+  }
+  return radix_bits;
+}
+
+std::shared_ptr<const Table> JoinHash::_on_execute() {
+  const auto& data_type = _input_table_left()->column_type(_column_ids.first);
+  Assert(data_type == _input_table_right()->column_type(_column_ids.second),
+         "JoinHash requires both join columns to have the same type");
+
+  std::shared_ptr<const Table> output;
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    output = _join<Type>();
+  });
+  return output;
+}
+
+template <typename T>
+std::shared_ptr<const Table> JoinHash::_join() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  const auto build_left = _mode == JoinMode::Inner && left_table->row_count() < right_table->row_count();
+  const auto& build_table = build_left ? left_table : right_table;
+  const auto& probe_table = build_left ? right_table : left_table;
+  const auto build_column_id = build_left ? _column_ids.first : _column_ids.second;
+  const auto probe_column_id = build_left ? _column_ids.second : _column_ids.first;
+
+  const auto radix_bits = _radix_bits ? *_radix_bits : default_radix_bits(build_table->row_count());
+  const auto chunk_pos_lists =
+      radix_bits == 0
+          ? join_unpartitioned<T>(*build_table, build_column_id, *probe_table, probe_column_id, _mode)
+          : join_radix_partitioned<T>(*build_table, build_column_id, *probe_table, probe_column_id, _mode, radix_bits);
+
+  if (!build_left) {
+    return _create_output_table(chunk_pos_lists);
+  }
+
+  // The left input was the build input, so the PosLists are swapped to match the order of the output columns
+  std::vector<JoinPosLists> left_and_right_pos_lists;
+  left_and_right_pos_lists.reserve(chunk_pos_lists.size());
+  for (const auto& [probe_pos_list, build_pos_list] : chunk_pos_lists) {
+    left_and_right_pos_lists.emplace_back(build_pos_list, probe_pos_list);
+  }
+  return _create_output_table(left_and_right_pos_lists);
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Joins two tables on the equality of one column of each of them, see AbstractJoinOperator. Both join columns have to
+// be of the same type.
+//
+// A hash table is built on the values of one input and probed with the other one. Inner joins build the hash table on
+// the smaller input. Left and semi joins always build it on the right input, so that every left row can be emitted,
+// with or without a join partner, while it is probed.
+//
+// Once the hash table outgrows the CPU caches, nearly every probe misses the cache and the TLB. Large joins therefore
+// first radix-partition both inputs by the highest radix_bits bits of the hashes of their join values. Each pass of the
+// partitioning splits the partitions by at most RADIX_BITS_PER_PASS more bits, which keeps the number of partitions
+// written to at a time small enough for the TLB. Afterwards, each pair of build and probe partitions is joined in its
+// own job with a hash table that fits in the cache. Without partitioning (radix_bits == 0), the probe input is
+// processed chunk by chunk in parallel jobs instead, and each of its chunks that has matches becomes one output chunk.
+class JoinHash : public AbstractJoinOperator {
+ public:
+  // If radix_bits is not given, default_radix_bits() chooses it based on the size of the build input. An explicit
+  // radix_bits must not exceed MAX_RADIX_BITS.
+  JoinHash(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+           const JoinMode mode, const std::pair<ColumnID, ColumnID>& column_ids,
+           const std::optional<uint8_t> radix_bits = std::nullopt);
+
+  const std::string name() const override;
+
+  const std::optional<uint8_t>& radix_bits() const;
+
+  // Returns the smallest number of radix bits for which the partitions of the build input have at most
+  // JOIN_HASH_PARTITION_ROW_COUNT rows on average, or 0 if the build input is small enough to not be partitioned at all
+  static uint8_t default_radix_bits(const size_t build_row_count);
+
+  // number of bits by which a single pass of the radix partitioning splits the partitions, i.e., each pass writes to at
+  // most 2^RADIX_BITS_PER_PASS partitions at a time
+  static constexpr uint8_t RADIX_BITS_PER_PASS = 8;
+
+  // number of build rows per partition that default_radix_bits() aims for, so that a partition's hash table fits in L2
+  static constexpr size_t JOIN_HASH_PARTITION_ROW_COUNT = 4096;
+
+  // upper bound of radix_bits, which limits the number of (mostly tiny) partitions and their offsets for huge inputs
+  static constexpr uint8_t MAX_RADIX_BITS = 16;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  template <typename T>
+  std::shared_ptr<const Table> _join();
+
+  std::optional<uint8_t> _radix_bits;
+};
+
+}  // namespace opossum
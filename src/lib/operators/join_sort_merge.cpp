@@ -0,0 +1,273 @@
+#include "join_sort_merge.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operator_utils.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+struct SortedValue {
+  RowID row_id;
+  SegmentValueType<T> value;
+};
+
+template <typename T>
+struct SortedColumn {
+  // the values of the column that are not NULL, sorted in ascending order
+  std::vector<SortedValue<T>> values;
+
+  // the positions whose value is NULL, which never find a join partner
+  PosList null_row_ids;
+
+  // the segments that string values point into, see collect_value_segments()
+  std::vector<std::shared_ptr<const BaseSegment>> segments;
+};
+
+template <typename T>
+bool value_less(const SortedValue<T>& lhs, const SortedValue<T>& rhs) {
+  return lhs.value < rhs.value;
+}
+
+// Sorts the values of a DictionarySegment by its ValueIDs. As the dictionary is sorted, the order of the ValueIDs is
+// the order of the values, so a counting sort places each position without comparing any values.
+template <typename T>
+void sort_dictionary_segment(const DictionarySegment<T>& segment, const ChunkID chunk_id,
+                             std::vector<SortedValue<T>>& sorted_values) {
+  const auto& dictionary = *segment.dictionary();
+  std::vector<ValueID::base_type> value_ids(segment.size());
+  segment.attribute_vector()->decode_into(0, value_ids);
+
+  // value_id_offsets[value_id] is the position at which the next row with this ValueID is written
+  std::vector<size_t> value_id_offsets(dictionary.size() + 1);
+  for (const auto value_id : value_ids) {
+    ++value_id_offsets[value_id + 1];
+  }
+  std::partial_sum(value_id_offsets.begin(), value_id_offsets.end(), value_id_offsets.begin());
+
+  sorted_values.resize(value_ids.size());
+  for (ChunkOffset chunk_offset = 0; chunk_offset < value_ids.size(); ++chunk_offset) {
+    const auto value_id = value_ids[chunk_offset];
+    sorted_values[value_id_offsets[value_id]++] = SortedValue<T>{RowID{chunk_id, chunk_offset}, dictionary[value_id]};
+  }
+}
+
+template <typename T>
+SortedColumn<T> sort_column(const Table& table, const ColumnID column_id) {
+  SortedColumn<T> sorted_column;
+  if constexpr (std::is_same_v<T, std::string>) {
+    sorted_column.segments = collect_value_segments(table, column_id);
+  }
+
+  // Each job sorts the values of one chunk
+  const auto chunk_count = table.chunk_count();
+  std::vector<std::vector<SortedValue<T>>> sorted_runs(chunk_count);
+  std::vector<PosList> chunk_null_row_ids(chunk_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (table.get_chunk(chunk_id).size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto segment = table.get_chunk(chunk_id).get_segment(column_id);
+      auto& sorted_run = sorted_runs[chunk_id];
+
+      if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+        sort_dictionary_segment(*dictionary_segment, chunk_id, sorted_run);
+        return;
+      }
+
+      sorted_run.reserve(segment->size());
+      segment_iterate<T>(*segment, [&](const auto& position) {
+        const auto row_id = RowID{chunk_id, position.chunk_offset()};
+        if (position.is_null()) {
+          chunk_null_row_ids[chunk_id].emplace_back(row_id);
+          return;
+        }
+        sorted_run.emplace_back(SortedValue<T>{row_id, position.value()});
+      });
+      std::sort(sorted_run.begin(), sorted_run.end(), value_less<T>);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& null_row_ids : chunk_null_row_ids) {
+    sorted_column.null_row_ids.insert(sorted_column.null_row_ids.end(), null_row_ids.cbegin(), null_row_ids.cend());
+  }
+
+  // The sorted runs are merged pairwise, with one job per pair, until a single run is left
+  sorted_runs.erase(std::remove_if(sorted_runs.begin(), sorted_runs.end(), [](const auto& run) { return run.empty(); }),
+                    sorted_runs.end());
+  while (sorted_runs.size() > 1) {
+    std::vector<std::vector<SortedValue<T>>> merged_runs((sorted_runs.size() + 1) / 2);
+    jobs.clear();
+    for (size_t merged_run_id = 0; merged_run_id < sorted_runs.size() / 2; ++merged_run_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, merged_run_id]() {
+        const auto& first_run = sorted_runs[2 * merged_run_id];
+        const auto& second_run = sorted_runs[2 * merged_run_id + 1];
+        auto& merged_run = merged_runs[merged_run_id];
+        merged_run.resize(first_run.size() + second_run.size());
+        std::merge(first_run.cbegin(), first_run.cend(), second_run.cbegin(), second_run.cend(), merged_run.begin(),
+                   value_less<T>);
+      }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+    if (sorted_runs.size() % 2 == 1) {
+      merged_runs.back() = std::move(sorted_runs.back());
+    }
+    sorted_runs = std::move(merged_runs);
+  }
+
+  if (!sorted_runs.empty()) {
+    sorted_column.values = std::move(sorted_runs.front());
+  }
+  return sorted_column;
+}
+
+// Returns the ranges [begin, end) of right_values that match a left value for the given scan type, given the range
+// [equal_begin, equal_end) of the right values that are equal to the left value
+std::array<std::pair<size_t, size_t>, 2> matching_ranges(const ScanType scan_type, const size_t equal_begin,
+                                                         const size_t equal_end, const size_t right_value_count) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return {{{equal_begin, equal_end}, {0, 0}}};
+    case ScanType::OpNotEquals:
+      return {{{0, equal_begin}, {equal_end, right_value_count}}};
+    case ScanType::OpLessThan:
+      return {{{equal_end, right_value_count}, {0, 0}}};
+    case ScanType::OpLessThanEquals:
+      return {{{equal_begin, right_value_count}, {0, 0}}};
+    case ScanType::OpGreaterThan:
+      return {{{0, equal_begin}, {0, 0}}};
+    case ScanType::OpGreaterThanEquals:
+      return {{{0, equal_end}, {0, 0}}};
+  }
+  Fail("Unknown scan type");
+  return {};
+}
+
+}  // namespace
+
+JoinSortMerge::JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
+                             const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                             const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type)
+    : AbstractJoinOperator(left, right, mode, column_ids, scan_type) {}
+
+const std::string JoinSortMerge::name() const { return "JoinSortMerge"; }
+
+std::shared_ptr<const Table> JoinSortMerge::_on_execute() {
+  const auto& data_type = _input_table_left()->column_type(_column_ids.first);
+  Assert(data_type == _input_table_right()->column_type(_column_ids.second),
+         "JoinSortMerge requires both join columns to have the same type");
+
+  std::shared_ptr<const Table> output;
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    output = _join<Type>();
+  });
+  return output;
+}
+
+template <typename T>
+std::shared_ptr<const Table> JoinSortMerge::_join() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  // Sorting the left input does not use all workers if it has fewer chunks than there are workers, so both inputs are
+  // sorted at the same time
+  SortedColumn<T> left_column;
+  SortedColumn<T> right_column;
+  CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{
+      std::make_shared<JobTask>([&]() { left_column = sort_column<T>(*left_table, _column_ids.first); }),
+      std::make_shared<JobTask>([&]() { right_column = sort_column<T>(*right_table, _column_ids.second); })});
+
+  const auto& left_values = left_column.values;
+  const auto& right_values = right_column.values;
+
+  // Each job merges one range of the sorted left values with all sorted right values
+  const auto job_count = std::max(size_t{1}, static_cast<size_t>(left_table->chunk_count()));
+  const auto job_value_count = (left_values.size() + job_count - 1) / job_count;
+  std::vector<JoinPosLists> job_pos_lists(job_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (size_t job_id = 0; job_id < job_count; ++job_id) {
+    const auto begin = job_id * job_value_count;
+    const auto end = std::min(begin + job_value_count, left_values.size());
+    if (begin >= end) break;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id, begin, end]() {
+      auto left_pos_list = std::make_shared<PosList>();
+      auto right_pos_list = std::make_shared<PosList>();
+
+      // The right values in [equal_begin, equal_end) are equal to the current left value. Both bounds only move
+      // forward, as the left values are sorted, so they are only searched for the first left value of the range.
+      auto equal_begin = static_cast<size_t>(
+          std::lower_bound(right_values.cbegin(), right_values.cend(), left_values[begin], value_less<T>) -
+          right_values.cbegin());
+      auto equal_end = equal_begin;
+
+      for (auto left_index = begin; left_index < end; ++left_index) {
+        const auto& left_value = left_values[left_index];
+        while (equal_begin < right_values.size() && right_values[equal_begin].value < left_value.value) {
+          ++equal_begin;
+        }
+        equal_end = std::max(equal_end, equal_begin);
+        while (equal_end < right_values.size() && !(left_value.value < right_values[equal_end].value)) {
+          ++equal_end;
+        }
+
+        const auto ranges = matching_ranges(_scan_type, equal_begin, equal_end, right_values.size());
+        const auto has_match = ranges[0].first < ranges[0].second || ranges[1].first < ranges[1].second;
+        if (!has_match) {
+          if (_mode == JoinMode::Left) {
+            left_pos_list->emplace_back(left_value.row_id);
+            right_pos_list->emplace_back(NULL_ROW_ID);
+          }
+          continue;
+        }
+
+        if (_mode == JoinMode::Semi) {
+          left_pos_list->emplace_back(left_value.row_id);
+          continue;
+        }
+
+        for (const auto& [range_begin, range_end] : ranges) {
+          for (auto right_index = range_begin; right_index < range_end; ++right_index) {
+            left_pos_list->emplace_back(left_value.row_id);
+            right_pos_list->emplace_back(right_values[right_index].row_id);
+          }
+        }
+      }
+
+      job_pos_lists[job_id] = {std::move(left_pos_list), std::move(right_pos_list)};
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // Left joins emit the left rows with NULL values without join partner
+  if (_mode == JoinMode::Left && !left_column.null_row_ids.empty()) {
+    const auto& null_row_ids = left_column.null_row_ids;
+    job_pos_lists.emplace_back(std::make_shared<PosList>(null_row_ids),
+                               std::make_shared<PosList>(null_row_ids.size(), NULL_ROW_ID));
+  }
+
+  return _create_output_table(job_pos_lists);
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Joins two tables on a comparison of one column of each of them, i.e., left_value <scan_type> right_value, see
+// AbstractJoinOperator. Unlike JoinHash, this also supports non-equi joins such as range joins. Both join columns have
+// to be of the same type.
+//
+// Both join columns are materialized and sorted. Each chunk is sorted by its own job. DictionarySegments are sorted by
+// a counting sort on their ValueIDs, as their dictionaries are already sorted, so no values are compared. The sorted
+// chunks are then merged pairwise, again in parallel jobs. Finally, the sorted left values are split into one range per
+// left chunk, and each range is merged with the sorted right values in its own job. For each left value, the matching
+// right values form at most two ranges of the sorted right values, whose bounds only move forward while the left values
+// increase. Each job's matches become one output chunk.
+class JoinSortMerge : public AbstractJoinOperator {
+ public:
+  JoinSortMerge(const std::shared_ptr<const AbstractOperator> left,
+                const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  template <typename T>
+  std::shared_ptr<const Table> _join();
+};
+
+}  // namespace opossum
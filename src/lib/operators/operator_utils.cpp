@@ -0,0 +1,192 @@
+#include "operator_utils.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "conjunctive_table_scan.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void add_reference_segments(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                            const std::shared_ptr<const PosList>& pos_list) {
+  const auto column_count = input_table->column_count();
+  const auto& first_chunk = input_table->get_chunk(ChunkID{0});
+  const auto input_is_referencing = first_chunk.column_count() > 0 && std::dynamic_pointer_cast<const ReferenceSegment>(
+                                                                          first_chunk.get_segment(ColumnID{0}));
+
+  if (!input_is_referencing) {
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+    }
+    return;
+  }
+
+  // The input chunks that pos_list refers to, in the order of their first occurrence, and their index in that order.
+  // Only their segments are needed. A PosList mostly refers to few chunks of a large input, so they are kept in a map
+  // instead of a vector with an entry per input chunk.
+  std::vector<ChunkID> input_chunk_ids;
+  std::unordered_map<ChunkID, size_t> input_chunk_indices;
+  for (const auto& row_id : *pos_list) {
+    if (row_id != NULL_ROW_ID && input_chunk_indices.emplace(row_id.chunk_id, input_chunk_ids.size()).second) {
+      input_chunk_ids.push_back(row_id.chunk_id);
+    }
+  }
+  // Without any positions, the first chunk still tells which table is referenced
+  if (input_chunk_ids.empty()) {
+    input_chunk_ids.push_back(ChunkID{0});
+  }
+
+  // Columns that were, e.g., produced by the same scan have the same input PosLists and get the same translated one
+  std::map<std::vector<std::shared_ptr<const PosList>>, std::shared_ptr<PosList>> translated_pos_lists;
+
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    // The PosLists of the column in the input chunks, in the order of input_chunk_ids
+    std::vector<std::shared_ptr<const PosList>> input_pos_lists;
+    std::shared_ptr<const ReferenceSegment> first_reference_segment;
+
+    for (const auto& chunk_id : input_chunk_ids) {
+      const auto reference_segment =
+          std::dynamic_pointer_cast<const ReferenceSegment>(input_table->get_chunk(chunk_id).get_segment(column_id));
+      Assert(reference_segment, "Tables must not mix ReferenceSegments with other segment types");
+      if (!first_reference_segment) {
+        first_reference_segment = reference_segment;
+      } else {
+        Assert(reference_segment->referenced_table() == first_reference_segment->referenced_table() &&
+                   reference_segment->referenced_column_id() == first_reference_segment->referenced_column_id(),
+               "The ReferenceSegments of a column must all reference the same table and column");
+      }
+      input_pos_lists.push_back(reference_segment->pos_list());
+    }
+
+    auto& translated_pos_list = translated_pos_lists[input_pos_lists];
+    if (!translated_pos_list) {
+      translated_pos_list = std::make_shared<PosList>();
+      translated_pos_list->reserve(pos_list->size());
+      // Consecutive positions mostly refer to the same input chunk, whose PosList is only looked up once
+      auto current_chunk_id = INVALID_CHUNK_ID;
+      const PosList* current_input_pos_list = nullptr;
+      for (const auto& row_id : *pos_list) {
+        if (row_id == NULL_ROW_ID) {
+          translated_pos_list->push_back(NULL_ROW_ID);
+          continue;
+        }
+        if (row_id.chunk_id != current_chunk_id) {
+          current_chunk_id = row_id.chunk_id;
+          current_input_pos_list = input_pos_lists[input_chunk_indices[current_chunk_id]].get();
+        }
+        translated_pos_list->push_back((*current_input_pos_list)[row_id.chunk_offset]);
+      }
+    }
+
+    output_chunk.add_segment(std::make_shared<ReferenceSegment>(first_reference_segment->referenced_table(),
+                                                                first_reference_segment->referenced_column_id(),
+                                                                translated_pos_list));
+  }
+}
+
+std::vector<std::shared_ptr<const BaseSegment>> collect_value_segments(const Table& table, const ColumnID column_id) {
+  std::vector<std::shared_ptr<const BaseSegment>> segments;
+  std::unordered_set<std::shared_ptr<const Table>> referenced_tables;
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& chunk = table.get_chunk(chunk_id);
+    if (chunk.size() == 0) continue;
+
+    const auto segment = chunk.get_segment(column_id);
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+    if (!reference_segment) {
+      segments.emplace_back(segment);
+      continue;
+    }
+
+    const auto& referenced_table = reference_segment->referenced_table();
+    if (!referenced_tables.insert(referenced_table).second) continue;
+    for (ChunkID referenced_chunk_id{0}; referenced_chunk_id < referenced_table->chunk_count(); ++referenced_chunk_id) {
+      const auto& referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
+      if (referenced_chunk.size() == 0) continue;
+      segments.emplace_back(referenced_chunk.get_segment(reference_segment->referenced_column_id()));
+    }
+  }
+
+  return segments;
+}
+
+std::shared_ptr<BaseSegment> materialize_segment(const BaseSegment& segment, const std::string& data_type) {
+  std::shared_ptr<BaseSegment> value_segment;
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+    std::vector<Type> values;
+    values.reserve(segment.size());
+    segment_iterate<Type>(segment, [&](const auto& position) {
+      Assert(!position.is_null(), "ValueSegments cannot store NULLs");
+      values.emplace_back(position.value());
+    });
+    value_segment = std::make_shared<ValueSegment<Type>>(std::move(values));
+  });
+  return value_segment;
+}
+
+std::shared_ptr<PosList> matches_to_pos_list(const std::vector<uint8_t>& matches, const ChunkID chunk_id) {
+  // The last position might be written behind the last match, hence the additional entry
+  const auto match_count = static_cast<size_t>(std::count(matches.cbegin(), matches.cend(), uint8_t{1}));
+  auto pos_list = std::make_shared<PosList>(match_count + 1);
+  auto output_index = size_t{0};
+  for (ChunkOffset chunk_offset{0}; chunk_offset < matches.size(); ++chunk_offset) {
+    (*pos_list)[output_index] = RowID{chunk_id, chunk_offset};
+    output_index += matches[chunk_offset];
+  }
+  pos_list->resize(match_count);
+  return pos_list;
+}
+
+std::shared_ptr<Table> create_reference_output_table(const std::shared_ptr<const Table>& input_table,
+                                                     const std::vector<std::shared_ptr<PosList>>& pos_lists) {
+  auto output_table = std::make_shared<Table>(input_table->chunk_size());
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+
+  for (const auto& pos_list : pos_lists) {
+    if (!pos_list || pos_list->empty()) continue;
+
+    Chunk output_chunk;
+    add_reference_segments(output_chunk, input_table, pos_list);
+    output_table->emplace_chunk(output_chunk);
+  }
+
+  if (output_table->row_count() == 0) {
+    add_reference_segments(output_table->get_chunk(ChunkID{0}), input_table, std::make_shared<PosList>());
+  }
+
+  return output_table;
+}
+
+std::vector<std::pair<ColumnID, std::vector<ScanPredicate>>> group_predicates_by_column(
+    const std::vector<ScanPredicate>& predicates) {
+  std::vector<std::pair<ColumnID, std::vector<ScanPredicate>>> predicates_by_column;
+  for (const auto& predicate : predicates) {
+    const auto column = std::find_if(predicates_by_column.begin(), predicates_by_column.end(),
+                                     [&](const auto& column) { return column.first == predicate.column_id; });
+    if (column == predicates_by_column.end()) {
+      predicates_by_column.emplace_back(predicate.column_id, std::vector<ScanPredicate>{predicate});
+    } else {
+      column->second.emplace_back(predicate);
+    }
+  }
+  return predicates_by_column;
+}
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_attribute_vector.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class Chunk;
+class Table;
+struct ScanPredicate;
+
+// number of rows that the scans that keep one match byte per row, e.g., ConjunctiveTableScan, skip at once, also the
+// number of ValueIDs that they unpack at once from a bit-packed attribute vector
+constexpr size_t SCAN_BLOCK_SIZE = 1024;
+
+// Adds a ReferenceSegment for every column of input_table to output_chunk, so that the chunk contains the rows of
+// input_table at the positions of pos_list. NULL_ROW_IDs in pos_list stay NULL.
+//
+// ReferenceSegments never reference other ReferenceSegments. If input_table consists of ReferenceSegments, e.g.,
+// because it is the output of another TableScan or join, the positions are translated into positions of the tables
+// that these ReferenceSegments reference. Columns whose input segments share their PosLists also share the translated
+// PosList.
+void add_reference_segments(Chunk& output_chunk, const std::shared_ptr<const Table>& input_table,
+                            const std::shared_ptr<const PosList>& pos_list);
+
+// Returns the segments that hold the values of a column, which for ReferenceSegments are the referenced segments.
+// Operators that keep string_views into a column beyond a single segment_iterate() call hold these segments, so that
+// the string_views stay valid even if the ChunkCompressionService replaces segments of the table in the meantime.
+std::vector<std::shared_ptr<const BaseSegment>> collect_value_segments(const Table& table, const ColumnID column_id);
+
+// Returns a ValueSegment of the given data type with the values of segment. As ValueSegments cannot store NULLs, the
+// segment must not contain any.
+std::shared_ptr<BaseSegment> materialize_segment(const BaseSegment& segment, const std::string& data_type);
+
+// Returns the positions of the rows of the chunk whose byte in matches is 1. Every position is written, but only
+// matches advance the output index, which avoids a branch per row.
+std::shared_ptr<PosList> matches_to_pos_list(const std::vector<uint8_t>& matches, const ChunkID chunk_id);
+
+// Returns a table with the columns of input_table and one chunk of ReferenceSegments (see add_reference_segments) per
+// non-empty PosList, in their order. Entries can be nullptr, e.g., for pruned chunks. Without any position, the initial
+// chunk of the table gets empty ReferenceSegments, like the output of TableScan.
+std::shared_ptr<Table> create_reference_output_table(const std::shared_ptr<const Table>& input_table,
+                                                     const std::vector<std::shared_ptr<PosList>>& pos_lists);
+
+// Groups the predicates by their columns, which are kept in the order of their first predicate
+std::vector<std::pair<ColumnID, std::vector<ScanPredicate>>> group_predicates_by_column(
+    const std::vector<ScanPredicate>& predicates);
+
+// Calls func(begin, end) for every block of SCAN_BLOCK_SIZE rows [begin, end) in which at least one byte of matches
+// equals value. A scan that only clears matches skips the blocks without a 1, a scan that only sets them skips the
+// blocks without a 0.
+template <typename Functor>
+void for_each_block_containing(const std::vector<uint8_t>& matches, const uint8_t value, const Functor& func) {
+  for (size_t block_begin = 0; block_begin < matches.size(); block_begin += SCAN_BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + SCAN_BLOCK_SIZE, matches.size());
+    const auto block_matches_end = matches.cbegin() + block_end;
+    if (std::find(matches.cbegin() + block_begin, block_matches_end, value) == block_matches_end) {
+      continue;
+    }
+    func(block_begin, block_end);
+  }
+}
+
+// Calls func(value_ids, first_row_id, begin, end) for the blocks of for_each_block_containing(matches, value), where
+// value_ids[row_id - first_row_id] is the ValueID of row_id. Bit-packed attribute vectors are unpacked block by block,
+// so that skipped blocks are not unpacked at all. The ValueIDs of the other attribute vectors are read directly.
+template <typename Functor>
+void for_each_value_id_block(const BaseAttributeVector& attribute_vector, const std::vector<uint8_t>& matches,
+                             const uint8_t value, const Functor& func) {
+  resolve_attribute_vector(attribute_vector, [&](const auto& typed_attribute_vector) {
+    using VectorType = std::decay_t<decltype(typed_attribute_vector)>;
+
+    if constexpr (std::is_same_v<VectorType, BitPackedAttributeVector>) {
+      std::vector<ValueID::base_type> block(SCAN_BLOCK_SIZE);
+      for_each_block_containing(matches, value, [&](const size_t block_begin, const size_t block_end) {
+        block.resize(block_end - block_begin);
+        typed_attribute_vector.decode_into(static_cast<ChunkOffset>(block_begin), block);
+        func(block, block_begin, block_begin, block_end);
+      });
+    } else {
+      const auto& value_ids = typed_attribute_vector.values();
+      for_each_block_containing(matches, value, [&](const size_t block_begin, const size_t block_end) {
+        func(value_ids, size_t{0}, block_begin, block_end);
+      });
+    }
+  });
+}
+
+}  // namespace opossum
@@ -66,6 +66,8 @@ std::shared_ptr<const Table> Print::_on_execute() {
   return _input_table_left();
 }
 
+bool Print::_creates_output() const { return false; }
+
 // In order to print the table as an actual table, with columns being aligned, we need to calculate the
 // number of characters in the printed representation of each column
 // `min` and `max` can be used to limit the width of the columns - however, every column fits at least the column's name
@@ -91,4 +93,6 @@ std::vector<uint16_t> Print::column_string_widths(uint16_t min, uint16_t max, st
   return widths;
 }
 
+const std::string Print::name() const { return "Print"; }
+
 }  // namespace opossum
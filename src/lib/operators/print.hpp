@@ -16,11 +16,14 @@ class Print : public AbstractOperator {
  public:
   explicit Print(const std::shared_ptr<const AbstractOperator> in, std::ostream& out = std::cout);
 
+  const std::string name() const override;
+
   static void print(std::shared_ptr<const Table> table, std::ostream& out = std::cout);
 
  protected:
   std::vector<uint16_t> column_string_widths(uint16_t min, uint16_t max, std::shared_ptr<const Table> t) const;
   std::shared_ptr<const Table> _on_execute() override;
+  bool _creates_output() const override;
 
   // stream to print the result
   std::ostream& _out;
@@ -0,0 +1,150 @@
+#include "projection.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/column_expression.hpp"
+#include "expression/expression_evaluator.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator> in,
+                       const std::vector<std::shared_ptr<AbstractExpression>>& expressions)
+    : AbstractOperator(in), _expressions(expressions) {
+  Assert(!_expressions.empty(), "Projection requires at least one expression");
+}
+
+const std::string Projection::name() const { return "Projection"; }
+
+const std::vector<std::shared_ptr<AbstractExpression>>& Projection::expressions() const { return _expressions; }
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto has_computed_columns = false;
+  for (const auto& expression : _expressions) {
+    if (expression->type() != ExpressionType::Column) {
+      has_computed_columns = true;
+      continue;
+    }
+    const auto column_id = static_cast<const ColumnExpression&>(*expression).column_id();
+    Assert(input_table->column_type(column_id) == expression->data_type(),
+           "Column " + expression->description() + " does not have the data type " + expression->data_type());
+  }
+
+  // Each job evaluates the expressions that are not forwarded columns for one chunk. The rows for which a computed
+  // column is NULL are marked in its entry of computed_nulls.
+  std::vector<std::vector<std::shared_ptr<BaseSegment>>> computed_segments(chunk_count);
+  std::vector<std::vector<std::vector<bool>>> computed_nulls(chunk_count);
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  if (has_computed_columns) {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        ExpressionEvaluator evaluator(input_table, chunk_id);
+        for (const auto& expression : _expressions) {
+          if (expression->type() == ExpressionType::Column) continue;
+          computed_nulls[chunk_id].emplace_back();
+          computed_segments[chunk_id].emplace_back(
+              evaluator.evaluate_to_segment(*expression, computed_nulls[chunk_id].back()));
+        }
+      }));
+    }
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto output_table = std::make_shared<Table>();
+  for (const auto& expression : _expressions) {
+    output_table->add_column_definition(expression->description(), expression->data_type());
+  }
+
+  // The output consists of ReferenceSegments if the input does, or if a computed column has NULLs, which only
+  // ReferenceSegments can represent (as NULL_ROW_ID). In both cases, the computed segments are stored in an additional
+  // table, which the output references. As tables must not mix ReferenceSegments with other segments, the forwarded
+  // columns of an input without ReferenceSegments are then referenced as well.
+  const auto& first_chunk = input_table->get_chunk(ChunkID{0});
+  const auto input_is_referencing = first_chunk.column_count() > 0 && std::dynamic_pointer_cast<const ReferenceSegment>(
+                                                                          first_chunk.get_segment(ColumnID{0}));
+  const auto has_nulls = std::any_of(computed_nulls.cbegin(), computed_nulls.cend(), [](const auto& chunk_nulls) {
+    return std::any_of(chunk_nulls.cbegin(), chunk_nulls.cend(), [](const auto& nulls) { return !nulls.empty(); });
+  });
+  const auto output_is_referencing = input_is_referencing || has_nulls;
+
+  auto computed_table = std::shared_ptr<Table>{};
+  if (output_is_referencing && has_computed_columns) {
+    computed_table = std::make_shared<Table>();
+    for (const auto& expression : _expressions) {
+      if (expression->type() == ExpressionType::Column) continue;
+      computed_table->add_column_definition(expression->description(), expression->data_type());
+    }
+  }
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& input_chunk = input_table->get_chunk(chunk_id);
+
+    // The computed segments of this chunk, or ReferenceSegments to them if the output consists of ReferenceSegments
+    auto& segments = computed_segments[chunk_id];
+    if (computed_table) {
+      Chunk computed_chunk;
+      for (const auto& segment : segments) {
+        computed_chunk.add_segment(segment);
+      }
+      computed_table->emplace_chunk(computed_chunk);
+
+      // Columns without NULLs share a PosList, the others get their own one with NULL_ROW_IDs
+      const auto computed_chunk_id = ChunkID{computed_table->chunk_count() - 1};
+      auto pos_list = std::make_shared<PosList>(input_chunk.size());
+      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk.size(); ++chunk_offset) {
+        (*pos_list)[chunk_offset] = RowID{computed_chunk_id, chunk_offset};
+      }
+      for (ColumnID column_id{0}; column_id < segments.size(); ++column_id) {
+        const auto& nulls = computed_nulls[chunk_id][column_id];
+        auto column_pos_list = pos_list;
+        if (!nulls.empty()) {
+          column_pos_list = std::make_shared<PosList>(*pos_list);
+          for (ChunkOffset chunk_offset{0}; chunk_offset < nulls.size(); ++chunk_offset) {
+            if (nulls[chunk_offset]) (*column_pos_list)[chunk_offset] = NULL_ROW_ID;
+          }
+        }
+        segments[column_id] = std::make_shared<ReferenceSegment>(computed_table, column_id, column_pos_list);
+      }
+    }
+
+    // The forwarded columns of an input without ReferenceSegments are referenced if the output has to consist of them
+    auto forwarded_pos_list = std::shared_ptr<PosList>{};
+    if (output_is_referencing && !input_is_referencing) {
+      forwarded_pos_list = std::make_shared<PosList>(input_chunk.size());
+      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk.size(); ++chunk_offset) {
+        (*forwarded_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
+    }
+
+    Chunk output_chunk;
+    auto computed_segment = segments.cbegin();
+    for (const auto& expression : _expressions) {
+      if (expression->type() != ExpressionType::Column) {
+        output_chunk.add_segment(*computed_segment++);
+        continue;
+      }
+
+      const auto column_id = static_cast<const ColumnExpression&>(*expression).column_id();
+      if (forwarded_pos_list) {
+        output_chunk.add_segment(std::make_shared<ReferenceSegment>(input_table, column_id, forwarded_pos_list));
+      } else {
+        output_chunk.add_segment(input_chunk.get_segment(column_id));
+      }
+    }
+    output_table->emplace_chunk(output_chunk);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
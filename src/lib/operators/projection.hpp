@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "expression/abstract_expression.hpp"
+
+namespace opossum {
+
+// Computes one output column from each expression, e.g., price * (1 - discount), named after the expression's
+// description. Each chunk is evaluated by its own job, using an ExpressionEvaluator.
+//
+// Columns that are just a ColumnExpression are not copied: the segments of the input column are forwarded, so a subset
+// of the input columns can be projected without touching their values. As tables must not mix ReferenceSegments with
+// other segments, the computed columns of a projection on ReferenceSegments are stored in an additional table, which
+// the output references with ReferenceSegments.
+//
+// Rows for which an expression is NULL, e.g., because of a division by zero, are NULL in the output. As only
+// ReferenceSegments can represent NULLs, with NULL_ROW_ID, the output then consists of ReferenceSegments as well.
+class Projection : public AbstractOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator> in,
+             const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
+  const std::string name() const override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& expressions() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>> _expressions;
+};
+
+}  // namespace opossum
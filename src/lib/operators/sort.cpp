@@ -0,0 +1,177 @@
+#include "sort.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operator_utils.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// number of rows that each sorted chunk contributes to the sample from which the splitters of the merge are chosen
+constexpr size_t MERGE_SAMPLES_PER_RUN = 32;
+
+}  // namespace
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const bool materialize_output)
+    : AbstractOperator(in), _sort_definitions(sort_definitions), _materialize_output(materialize_output) {
+  Assert(!_sort_definitions.empty(), "Sort requires at least one sort column");
+}
+
+const std::string Sort::name() const { return "Sort"; }
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
+
+bool Sort::materialize_output() const { return _materialize_output; }
+
+std::shared_ptr<const Table> Sort::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  std::vector<std::shared_ptr<const BaseSegment>> string_segments;
+  const auto sort_columns = make_sort_columns(*input_table, _sort_definitions, string_segments);
+  const auto compare = [&](const RowID& lhs, const RowID& rhs) { return compare_rows(sort_columns, lhs, rhs); };
+  const auto row_less = [&](const RowID& lhs, const RowID& rhs) { return compare(lhs, rhs) < 0; };
+
+  // Each job sorts one chunk, stably by one sort column after the other, starting with the least significant one
+  std::vector<PosList> sorted_runs(chunk_count);
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (input_table->get_chunk(chunk_id).size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      std::vector<ChunkOffset> chunk_offsets(chunk.size());
+      std::iota(chunk_offsets.begin(), chunk_offsets.end(), ChunkOffset{0});
+
+      for (const auto& sort_column : sort_columns) {
+        sort_column->materialize_chunk(chunk, chunk_id);
+      }
+      for (auto sort_column = sort_columns.crbegin(); sort_column != sort_columns.crend(); ++sort_column) {
+        (*sort_column)->sort_chunk(chunk_id, chunk_offsets);
+      }
+
+      auto& sorted_run = sorted_runs[chunk_id];
+      sorted_run.reserve(chunk_offsets.size());
+      for (const auto chunk_offset : chunk_offsets) {
+        sorted_run.emplace_back(RowID{chunk_id, chunk_offset});
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  sorted_runs.erase(std::remove_if(sorted_runs.begin(), sorted_runs.end(), [](const auto& run) { return run.empty(); }),
+                    sorted_runs.end());
+
+  // The splitters divide the output into one range per sorted run. They are chosen from a sample of every run, so that
+  // the ranges have about the same size. The rows of a range are those after the previous splitter and not after the
+  // next one, so equal rows always end up in the same range.
+  const auto partition_count = std::max(size_t{1}, sorted_runs.size());
+  PosList samples;
+  for (const auto& run : sorted_runs) {
+    const auto sample_count = std::min(run.size(), MERGE_SAMPLES_PER_RUN);
+    for (size_t sample_id = 0; sample_id < sample_count; ++sample_id) {
+      samples.emplace_back(run[sample_id * run.size() / sample_count]);
+    }
+  }
+  std::sort(samples.begin(), samples.end(), row_less);
+  PosList splitters;
+  for (size_t partition_id = 1; partition_id < partition_count; ++partition_id) {
+    splitters.emplace_back(samples[partition_id * samples.size() / partition_count]);
+  }
+
+  // Each job merges one range of all sorted runs, using a heap of the next row of each run, and creates one output
+  // chunk from it. Equal rows are taken from the runs in the order of their chunks, which keeps the merge stable.
+  std::vector<Chunk> output_chunks(partition_count);
+  jobs.clear();
+  for (size_t partition_id = 0; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      const auto range_end = [&](const PosList& run, const size_t splitter_id) {
+        if (splitter_id == splitters.size()) return run.size();
+        const auto end = std::upper_bound(run.cbegin(), run.cend(), splitters[splitter_id], row_less);
+        return static_cast<size_t>(std::distance(run.cbegin(), end));
+      };
+
+      // The next and the end position of each run within this range
+      std::vector<std::pair<size_t, size_t>> run_ranges;
+      auto row_count = size_t{0};
+      for (const auto& run : sorted_runs) {
+        const auto begin = partition_id == 0 ? size_t{0} : range_end(run, partition_id - 1);
+        run_ranges.emplace_back(begin, range_end(run, partition_id));
+        row_count += run_ranges.back().second - begin;
+      }
+      if (row_count == 0) return;
+
+      const auto comes_after = [&](const size_t lhs_run_id, const size_t rhs_run_id) {
+        const auto result = compare(sorted_runs[lhs_run_id][run_ranges[lhs_run_id].first],
+                                         sorted_runs[rhs_run_id][run_ranges[rhs_run_id].first]);
+        return result > 0 || (result == 0 && lhs_run_id > rhs_run_id);
+      };
+      std::priority_queue<size_t, std::vector<size_t>, decltype(comes_after)> heap{comes_after};
+      for (size_t run_id = 0; run_id < sorted_runs.size(); ++run_id) {
+        if (run_ranges[run_id].first < run_ranges[run_id].second) heap.push(run_id);
+      }
+
+      auto pos_list = std::make_shared<PosList>();
+      pos_list->reserve(row_count);
+      while (!heap.empty()) {
+        const auto run_id = heap.top();
+        heap.pop();
+        auto& [next, end] = run_ranges[run_id];
+        pos_list->emplace_back(sorted_runs[run_id][next]);
+        if (++next < end) heap.push(run_id);
+      }
+
+      auto& output_chunk = output_chunks[partition_id];
+      add_reference_segments(output_chunk, input_table, pos_list);
+      if (_materialize_output) {
+        Chunk materialized_chunk;
+        for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+          materialized_chunk.add_segment(
+              materialize_segment(*output_chunk.get_segment(column_id), input_table->column_type(column_id)));
+        }
+        output_chunk = std::move(materialized_chunk);
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  for (auto& output_chunk : output_chunks) {
+    if (output_chunk.size() == 0) continue;
+    output_table->emplace_chunk(output_chunk);
+  }
+
+  // Without any rows, the initial chunk of the output table gets empty segments, like in TableScan
+  if (output_table->row_count() == 0) {
+    auto& output_chunk = output_table->get_chunk(ChunkID{0});
+    if (_materialize_output) {
+      for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+        output_chunk.add_segment(
+            make_shared_by_data_type<BaseSegment, ValueSegment>(input_table->column_type(column_id)));
+      }
+    } else {
+      add_reference_segments(output_chunk, input_table, std::make_shared<PosList>());
+    }
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class OrderByMode { Ascending, Descending };
+
+struct SortColumnDefinition {
+  ColumnID column_id;
+  OrderByMode order_by_mode{OrderByMode::Ascending};
+};
+
+// Orders the rows of a table by one or more columns, where later columns only decide between rows that are equal in
+// all previous ones. The sort is stable, i.e., rows that are equal in all sort columns keep their order. NULLs are
+// smaller than all values, so they come first in ascending and last in descending order. The output consists of
+// ReferenceSegments to the input, unless materialize_output is set, in which case it consists of ValueSegments, which
+// requires the input to contain no NULLs.
+//
+// First, each chunk is sorted by its own job. Within a DictionarySegment, the attribute vector's ValueIDs are compared
+// instead of the values, as the dictionary is sorted. The sorted chunks are then combined with a parallel k-way merge:
+// the output is split into value ranges by splitters sampled from all sorted chunks, and each range is merged from all
+// sorted chunks by its own job, which becomes one output chunk.
+class Sort : public AbstractOperator {
+ public:
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const bool materialize_output = false);
+
+  const std::string name() const override;
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  bool materialize_output() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::vector<SortColumnDefinition> _sort_definitions;
+  bool _materialize_output;
+};
+
+}  // namespace opossum
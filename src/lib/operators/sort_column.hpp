@@ -0,0 +1,211 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "operator_utils.hpp"
+#include "resolve_type.hpp"
+#include "sort.hpp"
+#include "storage/chunk.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// The sort keys of one sort column, which are materialized chunk by chunk
+class BaseSortColumn {
+ public:
+  virtual ~BaseSortColumn() = default;
+
+  // Materializes the sort keys of a chunk. Can be called for different chunks concurrently.
+  virtual void materialize_chunk(const Chunk& chunk, const ChunkID chunk_id) = 0;
+
+  // Materializes the sort keys of the given rows of a chunk only, e.g., of the rows that TopN did not rule out based on
+  // the first sort column. Other rows of the chunk must not be compared or sorted afterwards.
+  virtual void materialize_chunk(const Chunk& chunk, const ChunkID chunk_id,
+                                 const std::vector<ChunkOffset>& chunk_offsets) = 0;
+
+  // Stably sorts offsets of a chunk by this column
+  virtual void sort_chunk(const ChunkID chunk_id, std::vector<ChunkOffset>& chunk_offsets) const = 0;
+
+  // Returns a negative number if lhs comes before rhs in the order of this column, a positive number if it comes after
+  // rhs, and zero if they are equal. The rows can be from different chunks.
+  virtual int compare(const RowID& lhs, const RowID& rhs) const = 0;
+
+  // Returns the ValueIDs of a materialized chunk if its segment is a DictionarySegment, and nullptr otherwise
+  virtual const std::vector<ValueID::base_type>* value_ids(const ChunkID chunk_id) const = 0;
+};
+
+template <typename T>
+class SortColumn : public BaseSortColumn {
+ public:
+  SortColumn(const ColumnID column_id, const OrderByMode order_by_mode, const ChunkID chunk_count)
+      : _column_id(column_id), _order_by_mode(order_by_mode), _chunk_keys(chunk_count) {}
+
+  void materialize_chunk(const Chunk& chunk, const ChunkID chunk_id) override {
+    auto& keys = _chunk_keys[chunk_id];
+    const auto segment = chunk.get_segment(_column_id);
+
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      keys.dictionary = dictionary_segment->dictionary();
+      keys.value_ids.resize(segment->size());
+      dictionary_segment->attribute_vector()->decode_into(0, keys.value_ids);
+      return;
+    }
+
+    keys.values.resize(segment->size());
+    segment_iterate<T>(*segment, [&](const auto& position) {
+      _materialize_position(keys, position.chunk_offset(), position, segment->size());
+    });
+  }
+
+  void materialize_chunk(const Chunk& chunk, const ChunkID chunk_id,
+                         const std::vector<ChunkOffset>& chunk_offsets) override {
+    auto& keys = _chunk_keys[chunk_id];
+    const auto segment = chunk.get_segment(_column_id);
+
+    // The keys are still indexed by chunk offset, but only the given rows are decoded
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      keys.dictionary = dictionary_segment->dictionary();
+      keys.value_ids.resize(segment->size());
+      const auto& attribute_vector = *dictionary_segment->attribute_vector();
+      for (const auto chunk_offset : chunk_offsets) {
+        keys.value_ids[chunk_offset] = attribute_vector.get(chunk_offset);
+      }
+      return;
+    }
+
+    keys.values.resize(segment->size());
+    segment_iterate_offsets<T>(*segment, chunk_offsets, [&](const auto& position) {
+      _materialize_position(keys, chunk_offsets[position.chunk_offset()], position, segment->size());
+    });
+  }
+
+  void sort_chunk(const ChunkID chunk_id, std::vector<ChunkOffset>& chunk_offsets) const override {
+    const auto& keys = _chunk_keys[chunk_id];
+
+    // The dictionary is sorted, so the order of the ValueIDs is the order of the values
+    if (keys.dictionary) {
+      const auto& value_ids = keys.value_ids;
+      _stable_sort(chunk_offsets, [&](const ChunkOffset lhs, const ChunkOffset rhs) {
+        return value_ids[lhs] < value_ids[rhs];
+      });
+      return;
+    }
+
+    const auto& values = keys.values;
+    if (keys.nulls.empty()) {
+      _stable_sort(chunk_offsets,
+                   [&](const ChunkOffset lhs, const ChunkOffset rhs) { return values[lhs] < values[rhs]; });
+      return;
+    }
+
+    const auto& nulls = keys.nulls;
+    _stable_sort(chunk_offsets, [&](const ChunkOffset lhs, const ChunkOffset rhs) {
+      return !nulls[rhs] && (nulls[lhs] || values[lhs] < values[rhs]);
+    });
+  }
+
+  int compare(const RowID& lhs, const RowID& rhs) const override {
+    const auto lhs_is_null = _is_null(lhs);
+    const auto rhs_is_null = _is_null(rhs);
+
+    auto result = 0;
+    if (lhs_is_null || rhs_is_null) {
+      result = lhs_is_null == rhs_is_null ? 0 : (lhs_is_null ? -1 : 1);
+    } else {
+      const auto lhs_value = _value(lhs);
+      const auto rhs_value = _value(rhs);
+      result = lhs_value < rhs_value ? -1 : (rhs_value < lhs_value ? 1 : 0);
+    }
+    return _order_by_mode == OrderByMode::Ascending ? result : -result;
+  }
+
+  const std::vector<ValueID::base_type>* value_ids(const ChunkID chunk_id) const override {
+    const auto& keys = _chunk_keys[chunk_id];
+    return keys.dictionary ? &keys.value_ids : nullptr;
+  }
+
+ protected:
+  // For DictionarySegments, the dictionary and the ValueIDs are kept instead of the values
+  struct ChunkKeys {
+    std::shared_ptr<const DictionaryType<T>> dictionary;
+    std::vector<ValueID::base_type> value_ids;
+    std::vector<SegmentValueType<T>> values;
+
+    // empty if the chunk has no NULLs
+    std::vector<bool> nulls;
+  };
+
+  void _materialize_position(ChunkKeys& keys, const ChunkOffset chunk_offset, const SegmentPosition<T>& position,
+                             const size_t chunk_size) const {
+    if (position.is_null()) {
+      if (keys.nulls.empty()) keys.nulls.resize(chunk_size);
+      keys.nulls[chunk_offset] = true;
+      return;
+    }
+    keys.values[chunk_offset] = position.value();
+  }
+
+  template <typename Less>
+  void _stable_sort(std::vector<ChunkOffset>& chunk_offsets, const Less& less) const {
+    if (_order_by_mode == OrderByMode::Ascending) {
+      std::stable_sort(chunk_offsets.begin(), chunk_offsets.end(), less);
+    } else {
+      std::stable_sort(chunk_offsets.begin(), chunk_offsets.end(),
+                       [&](const ChunkOffset lhs, const ChunkOffset rhs) { return less(rhs, lhs); });
+    }
+  }
+
+  bool _is_null(const RowID& row_id) const {
+    const auto& nulls = _chunk_keys[row_id.chunk_id].nulls;
+    return !nulls.empty() && nulls[row_id.chunk_offset];
+  }
+
+  SegmentValueType<T> _value(const RowID& row_id) const {
+    const auto& keys = _chunk_keys[row_id.chunk_id];
+    if (keys.dictionary) return (*keys.dictionary)[keys.value_ids[row_id.chunk_offset]];
+    return keys.values[row_id.chunk_offset];
+  }
+
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
+  std::vector<ChunkKeys> _chunk_keys;
+};
+
+// Creates the sort columns of table for the given definitions. String keys are string_views into the segments, so
+// the segments that hold them are added to string_segments, which has to be kept as long as the sort columns are used.
+inline std::vector<std::unique_ptr<BaseSortColumn>> make_sort_columns(
+    const Table& table, const std::vector<SortColumnDefinition>& sort_definitions,
+    std::vector<std::shared_ptr<const BaseSegment>>& string_segments) {
+  std::vector<std::unique_ptr<BaseSortColumn>> sort_columns;
+  for (const auto& definition : sort_definitions) {
+    resolve_data_type(table.column_type(definition.column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      sort_columns.emplace_back(
+          std::make_unique<SortColumn<Type>>(definition.column_id, definition.order_by_mode, table.chunk_count()));
+      if constexpr (std::is_same_v<Type, std::string>) {
+        const auto segments = collect_value_segments(table, definition.column_id);
+        string_segments.insert(string_segments.end(), segments.cbegin(), segments.cend());
+      }
+    });
+  }
+  return sort_columns;
+}
+
+// Compares two rows by all sort columns, like BaseSortColumn::compare()
+inline int compare_rows(const std::vector<std::unique_ptr<BaseSortColumn>>& sort_columns, const RowID& lhs,
+                        const RowID& rhs) {
+  for (const auto& sort_column : sort_columns) {
+    const auto result = sort_column->compare(lhs, rhs);
+    if (result != 0) return result;
+  }
+  return 0;
+}
+
+}  // namespace opossum
@@ -6,17 +6,25 @@
 namespace opossum {
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator> in, ColumnID column_id, const ScanType scan_type,
                      const AllTypeVariant search_value)
-    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {
-  _table_scan_impl = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(
-      _input_table_left()->column_type(_column_id), _column_id, _scan_type, _search_value, _input_table_left());
-}
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {}
 
 TableScan::~TableScan() = default;
 
 ColumnID TableScan::column_id() const { return _column_id; }
 ScanType TableScan::scan_type() const { return _scan_type; }
 const AllTypeVariant& TableScan::search_value() const { return _search_value; }
+size_t TableScan::pruned_chunk_count() const {
+  DebugAssert(_table_scan_impl, "pruned_chunk_count() can only be called after execute()");
+  return _table_scan_impl->pruned_chunk_count();
+}
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  // The column type is only known once the input was executed, which might not be the case when the plan is built
+  _table_scan_impl = make_unique_by_data_type<BaseTableScanImpl, TableScanImpl>(
+      _input_table_left()->column_type(_column_id), _column_id, _scan_type, _search_value, _input_table_left());
+  return _table_scan_impl->on_execute();
+}
 
-std::shared_ptr<const Table> TableScan::_on_execute() { return _table_scan_impl->on_execute(); }
+const std::string TableScan::name() const { return "TableScan"; }
 
 }  // namespace opossum
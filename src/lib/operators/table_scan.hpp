@@ -28,10 +28,15 @@ class TableScan : public AbstractOperator {
 
   ~TableScan();
 
+  const std::string name() const override;
+
   ColumnID column_id() const;
   ScanType scan_type() const;
   const AllTypeVariant& search_value() const;
 
+  // returns the number of input chunks that were skipped based on their min/max statistics
+  size_t pruned_chunk_count() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -39,7 +44,7 @@ class TableScan : public AbstractOperator {
   ScanType _scan_type;
   AllTypeVariant _search_value;
 
-  std::shared_ptr<const BaseTableScanImpl> _table_scan_impl;
+  std::shared_ptr<BaseTableScanImpl> _table_scan_impl;
 };
 
 }  // namespace opossum
@@ -2,10 +2,14 @@
 
 namespace opossum {
 
-void add_all_to_pos_list(std::shared_ptr<PosList> pos_list, ChunkID chunk_id,
+void add_all_to_pos_list(PosList& pos_list, ChunkID chunk_id,
                          const std::shared_ptr<const BaseAttributeVector> attribute_vector) {
-  for (ChunkOffset index = 0; index < attribute_vector->size(); ++index) {
-    pos_list->emplace_back(RowID{chunk_id, index});
+  add_range_to_pos_list(pos_list, chunk_id, 0, attribute_vector->size());
+}
+
+void add_range_to_pos_list(PosList& pos_list, ChunkID chunk_id, ChunkOffset begin, ChunkOffset end) {
+  for (ChunkOffset index = begin; index < end; ++index) {
+    pos_list.emplace_back(RowID{chunk_id, index});
   }
 }
 
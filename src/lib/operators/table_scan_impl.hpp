@@ -1,16 +1,27 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "abstract_operator.hpp"
 #include "all_type_variant.hpp"
+#include "operator_utils.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/segment_statistics.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -18,30 +29,100 @@
 
 namespace opossum {
 
+// number of ValueIDs that are unpacked at once when scanning a bit-packed attribute vector, also the number of ValueIDs
+// for which the PosList is grown at once
+constexpr size_t BIT_PACKED_SCAN_BLOCK_SIZE = 1024;
+
 class BaseTableScanImpl {
  public:
   virtual ~BaseTableScanImpl() {}
 
-  virtual std::shared_ptr<const Table> on_execute() const = 0;
+  virtual std::shared_ptr<const Table> on_execute() = 0;
+
+  // returns the number of chunks that were skipped because their min/max statistics exclude the predicate
+  size_t pruned_chunk_count() const { return _pruned_chunk_count; }
+
+ protected:
+  size_t _pruned_chunk_count = 0;
 };
 
+// Add the positions of all value ids that fulfill a specific condition (templated Comparator) with the given search_pos
+// to a PosList. The loop is written without branches so that the compiler can vectorize the comparison. It writes
+// every position and only advances on a match, so the PosList is grown block-wise to not over-allocate it by a whole
+// chunk.
+template <typename Compare, typename ValueIDType>
+void add_matching_value_ids_to_pos_list(PosList& pos_list, const ChunkID chunk_id,
+                                        const std::vector<ValueIDType>& value_ids, const ChunkOffset first_offset,
+                                        const ValueID search_pos) {
+  Compare compare = Compare();
+  const ValueID::base_type search_value_id = search_pos;
+
+  auto output_index = pos_list.size();
+  for (size_t block_begin = 0; block_begin < value_ids.size(); block_begin += BIT_PACKED_SCAN_BLOCK_SIZE) {
+    const auto block_end = std::min(block_begin + BIT_PACKED_SCAN_BLOCK_SIZE, value_ids.size());
+    pos_list.resize(output_index + (block_end - block_begin));
+    auto* const output = pos_list.data();
+    for (auto index = block_begin; index < block_end; ++index) {
+      output[output_index] = RowID{chunk_id, static_cast<ChunkOffset>(first_offset + index)};
+      output_index += compare(static_cast<ValueID::base_type>(value_ids[index]), search_value_id);
+    }
+    pos_list.resize(output_index);
+  }
+}
+
 // Add all ValueIDs of an DictionarySegment's attribute vector that fulfill a specific condition (templated Comparator, see dictionary segment scan part)
 // with the given search_pos to a PosList
 template <typename Compare>
-void add_to_pos_list(std::shared_ptr<PosList> pos_list, const ChunkID chunk_id,
+void add_to_pos_list(PosList& pos_list, const ChunkID chunk_id,
                      const std::shared_ptr<const BaseAttributeVector> attribute_vector, const ValueID search_pos) {
-  Compare compare = Compare();
-  for (ChunkOffset index = 0; index < attribute_vector->size(); ++index) {
-    if (compare(attribute_vector->get(index), search_pos)) {
-      pos_list->emplace_back(RowID{chunk_id, index});
+  resolve_attribute_vector(*attribute_vector, [&](const auto& typed_attribute_vector) {
+    using VectorType = std::decay_t<decltype(typed_attribute_vector)>;
+
+    if constexpr (std::is_same_v<VectorType, BitPackedAttributeVector>) {
+      // Bit-packed attribute vectors are unpacked block-wise, which avoids the bit fiddling of get() for every row
+      std::vector<ValueID::base_type> block(BIT_PACKED_SCAN_BLOCK_SIZE);
+      for (ChunkOffset block_start = 0; block_start < typed_attribute_vector.size(); block_start += block.size()) {
+        block.resize(std::min(block.size(), typed_attribute_vector.size() - block_start));
+        typed_attribute_vector.decode_into(block_start, block);
+        add_matching_value_ids_to_pos_list<Compare>(pos_list, chunk_id, block, block_start, search_pos);
+      }
+    } else {
+      add_matching_value_ids_to_pos_list<Compare>(pos_list, chunk_id, typed_attribute_vector.values(), 0,
+                                                  search_pos);
     }
-  }
+  });
 }
 
 // Add all ValueIDs of an DictionarySegment's attribute vector to a PosList
-void add_all_to_pos_list(std::shared_ptr<PosList> pos_list, ChunkID chunk_id,
+void add_all_to_pos_list(PosList& pos_list, ChunkID chunk_id,
                          const std::shared_ptr<const BaseAttributeVector> attribute_vector);
 
+// Add all positions in [begin, end) to a PosList, e.g., all rows of a matching run of a RunLengthSegment. The PosList
+// is not reserved for each range, as an exact reservation per call would reallocate it for every matching run.
+void add_range_to_pos_list(PosList& pos_list, ChunkID chunk_id, ChunkOffset begin, ChunkOffset end);
+
+// Calls func with the transparent comparator that implements the scan type, e.g., std::less<> for OpLessThan. Passing
+// the comparator as an object of its own type instead of a std::function allows the comparison to be inlined.
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& func) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return func(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return func(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return func(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return func(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return func(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return func(std::greater_equal<>{});
+    default:
+      Fail("Unrecognized ScanType");
+  }
+}
+
 template <typename T>
 class TableScanImpl : public BaseTableScanImpl {
  public:
@@ -52,156 +133,58 @@ class TableScanImpl : public BaseTableScanImpl {
         _search_value(type_cast<T>(search_value)),
         _input_table(input_table) {}
 
-  std::shared_ptr<const Table> on_execute() const override {
-    auto output_table = std::make_shared<Table>(_input_table->chunk_size());
-    auto pos_list = std::make_shared<PosList>();
-    // Use a pre defined lambda to capsual the comparison logic from the actual scan procedure, since the scan_type and _search_value don't change
-    const auto compare = _compare_lambda(_scan_type);
-    // Defined here to be used later in the reference segment. If the input table itselfs contains reference segments, the variable is set to the source table
-    std::shared_ptr<const Table> output_reference_table = _input_table;
+  std::shared_ptr<const Table> on_execute() override {
+    const auto chunk_count = _input_table->chunk_count();
+
+    // Every chunk is scanned by its own job into its own PosList, so that the chunks can be scanned in parallel and the
+    // output keeps the chunk structure of the input. Pruned and empty chunks keep a nullptr.
+    std::vector<std::shared_ptr<PosList>> pos_lists(chunk_count);
+    size_t pruned_chunk_count = 0;
 
-    for (auto chunk_id = ChunkID{0}; chunk_id < _input_table->chunk_count(); ++chunk_id) {
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
       const auto& chunk = _input_table->get_chunk(chunk_id);
 
       if (chunk.size() == 0) {
         continue;
       }
 
-      // Scan value segment
-      if (const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(chunk.get_segment(_column_id))) {
-        const auto& values = value_segment->values();
-        // Iterating over the value vector from the value segment and comparing every value with the pre defined compare lambda
-        for (ChunkOffset index = 0; index < values.size(); ++index) {
-          if (compare(values[index])) {
-            pos_list->emplace_back(RowID{chunk_id, index});
-          }
-        }
-        // Scan reference segment
-      } else if (auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(chunk.get_segment(_column_id))) {
-        // set the reference table for the output segments to the original source table
-        output_reference_table = reference_segment->referenced_table();
-        const auto referenced_pos_list = reference_segment->pos_list();
-        const auto reference_table = reference_segment->referenced_table();
-
-        for (uint32_t index = 0; index < referenced_pos_list->size(); index++) {
-          const auto& row_id = (*referenced_pos_list)[index];
-          // Depending on the source segment type we need to get the value on different ways
-          if (auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(
-                  reference_table->get_chunk(row_id.chunk_id).get_segment(_column_id))) {
-            if (compare(value_segment->values()[row_id.chunk_offset])) {
-              pos_list->emplace_back(row_id);
-            }
-          } else if (auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(
-                         reference_table->get_chunk(row_id.chunk_id).get_segment(_column_id))) {
-            if (compare(dictionary_segment->get(row_id.chunk_offset))) {
-              pos_list->emplace_back(row_id);
-            }
-          } else {
-            Fail("Column type could not be reconized");
-          }
-        }
-        // Scan dictionary segment
-      } else if (const auto dictionary_segment =
-                     std::dynamic_pointer_cast<DictionarySegment<T>>(chunk.get_segment(_column_id))) {
-        const auto dictionary = dictionary_segment->dictionary();
-        const auto attribute_vector = dictionary_segment->attribute_vector();
-
-        ValueID search_pos;
-        switch (_scan_type) {
-          case ScanType::OpEquals:
-            search_pos = dictionary_segment->lower_bound(_search_value);
-            if (search_pos != INVALID_VALUE_ID && (*dictionary)[search_pos] == _search_value) {
-              // If we find a lower bound candidate, and it is our _search_value,
-              // simply add all equal items of the attribute_vector.
-              add_to_pos_list<std::equal_to<ValueID>>(pos_list, chunk_id, attribute_vector, search_pos);
-            }
-            break;
-
-          case ScanType::OpNotEquals:
-            search_pos = dictionary_segment->lower_bound(_search_value);
-            if (search_pos != INVALID_VALUE_ID && (*dictionary)[search_pos] == _search_value) {
-              // If we find a lower bound candidate, and it is our _search_value,
-              // simply add all non-equal items of the attribute_vector.
-              add_to_pos_list<std::not_equal_to<ValueID>>(pos_list, chunk_id, attribute_vector, search_pos);
-            } else {
-              // else our _search_value is not in the dictionary, so add all.
-              add_all_to_pos_list(pos_list, chunk_id, attribute_vector);
-            }
-            break;
-
-          case ScanType::OpLessThan:
-            search_pos = dictionary_segment->lower_bound(_search_value);
-            if (search_pos != INVALID_VALUE_ID && (*dictionary)[search_pos] == _search_value) {
-              // If we find a lower bound candidate, and it is our _search_value,
-              // add all smaller ValueIDs because of the closed interval.
-              add_to_pos_list<std::less<ValueID>>(pos_list, chunk_id, attribute_vector, search_pos);
-            } else if (dictionary->back() < _search_value) {
-              // else, we did not find a candidate, but the greatest value in our
-              // dictionary is smaller than our _search_value, so add all.
-              add_all_to_pos_list(pos_list, chunk_id, attribute_vector);
-            }
-            break;
-
-          case ScanType::OpLessThanEquals:
-            search_pos = dictionary_segment->lower_bound(_search_value);
-            if (search_pos != INVALID_VALUE_ID) {
-              // If we find a lower bound candidate,
-              if ((*dictionary)[search_pos] == _search_value) {
-                // and if it is our _search_value, add all lesserequal ValueIDs because we want to include our value.
-                add_to_pos_list<std::less_equal<ValueID>>(pos_list, chunk_id, attribute_vector, search_pos);
-              } else {
-                // Else, we don't want to include the found value, because it is already larger.
-                add_to_pos_list<std::less<ValueID>>(pos_list, chunk_id, attribute_vector, search_pos);
-              }
-            } else if (dictionary->back() < _search_value) {
-              // If we did not find a candidate at all, but the greatest value in our
-              // dictionary is smaller than our _search_value, add all.
-              add_all_to_pos_list(pos_list, chunk_id, attribute_vector);
-            }
-            break;
-
-          case ScanType::OpGreaterThan:
-            search_pos = dictionary_segment->upper_bound(_search_value);
-
-            if (search_pos != INVALID_VALUE_ID) {
-              // If we find a lower bound candidate,
-              if ((*dictionary)[search_pos] == _search_value) {
-                // and if it is our _search_value, add all greater ValueIDs because we want to exclude our value.
-                add_to_pos_list<std::greater<ValueID>>(pos_list, chunk_id, attribute_vector, search_pos);
-              } else {
-                // Else, we do want to include the found value, because it is already larger.
-                add_to_pos_list<std::greater_equal<ValueID>>(pos_list, chunk_id, attribute_vector, search_pos);
-              }
-            }
-            break;
-
-          case ScanType::OpGreaterThanEquals:
-            search_pos = dictionary_segment->upper_bound(_search_value);
-            if (search_pos != INVALID_VALUE_ID) {
-              // If we find a lower bound candidate, and it is not the first element in the dictionary,
-              // we have to decrement the ValueID to include it. Then we can add all greater equal ValueIDs.
-              if (search_pos != ValueID{0}) {
-                search_pos--;
-              }
-              add_to_pos_list<std::greater_equal<ValueID>>(pos_list, chunk_id, attribute_vector, search_pos);
-            }
-            break;
-
-          default:
-            Fail("Unreconigzed ScanType");
-        }
+      // Skip chunks whose zone map shows that no value can match
+      if (const auto statistics = chunk.get_statistics(_column_id);
+          statistics && can_prune(*statistics, _scan_type, _search_value)) {
+        ++pruned_chunk_count;
+        continue;
       }
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        pos_lists[chunk_id] = std::make_shared<PosList>();
+        _scan_chunk(_input_table->get_chunk(chunk_id), chunk_id, *pos_lists[chunk_id]);
+      }));
     }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+    _pruned_chunk_count = pruned_chunk_count;
 
     // Create table structure
-    // We fill the Chunk created at the initialization of the output table with
-    // ReferenceSegments and add the column definitions manually to the table.
-    Chunk& output_chunk = output_table->get_chunk(ChunkID{0});
-
+    // Every input chunk with matches gets an output chunk of ReferenceSegments
+    auto output_table = std::make_shared<Table>(_input_table->chunk_size());
     for (ColumnID column_id = ColumnID{0}; column_id < _input_table->column_count(); column_id++) {
       output_table->add_column_definition(_input_table->column_name(column_id), _input_table->column_type(column_id));
-      // Every segment gets the same pos list and referenced table
-      output_chunk.add_segment(std::make_shared<ReferenceSegment>(output_reference_table, column_id, pos_list));
+    }
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (!pos_lists[chunk_id] || pos_lists[chunk_id]->empty()) {
+        continue;
+      }
+
+      Chunk output_chunk;
+      add_reference_segments(output_chunk, _input_table, pos_lists[chunk_id]);
+      output_table->emplace_chunk(output_chunk);
+    }
+
+    // Without any match, the chunk created at the initialization of the output table is kept and gets empty
+    // ReferenceSegments, so that the output still has its columns
+    if (output_table->row_count() == 0) {
+      add_reference_segments(output_table->get_chunk(ChunkID{0}), _input_table, std::make_shared<PosList>());
     }
 
     return output_table;
@@ -213,24 +196,158 @@ class TableScanImpl : public BaseTableScanImpl {
   T _search_value;
   std::shared_ptr<const Table> _input_table;
 
-  const std::function<bool(const T&)> _compare_lambda(const ScanType comp) const {
+  // Scans a single chunk and adds the matching positions of the input table to pos_list
+  void _scan_chunk(const Chunk& chunk, const ChunkID chunk_id, PosList& pos_list) const {
+    resolve_segment_type<T>(*chunk.get_segment(_column_id), [&](const auto& segment) {
+      using SegmentType = std::decay_t<decltype(segment)>;
+
+      if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+        _scan_dictionary_segment(pos_list, chunk_id, segment);
+      } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
+        _scan_frame_of_reference_segment(pos_list, chunk_id, segment);
+      } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+        const auto& run_values = *segment.values();
+        const auto& end_positions = *segment.end_positions();
+
+        // The predicate is evaluated once per run. If it matches, the whole run is added.
+        with_comparator(_scan_type, [&](const auto compare) {
+          ChunkOffset run_begin = 0;
+          for (size_t run = 0; run < run_values.size(); ++run) {
+            if (compare(run_values[run], _search_value)) {
+              add_range_to_pos_list(pos_list, chunk_id, run_begin, end_positions[run] + 1);
+            }
+            run_begin = end_positions[run] + 1;
+          }
+        });
+      } else {
+        // ValueSegments and ReferenceSegments. NULLs never match.
+        with_comparator(_scan_type, [&](const auto compare) {
+          segment_iterate<T>(segment, [&](const auto& position) {
+            if (!position.is_null() && compare(position.value(), _search_value)) {
+              pos_list.emplace_back(RowID{chunk_id, position.chunk_offset()});
+            }
+          });
+        });
+      }
+    });
+  }
+
+  // Translates the search value into ValueIDs, so that only the attribute vector has to be scanned
+  void _scan_dictionary_segment(PosList& pos_list, const ChunkID chunk_id, const DictionarySegment<T>& segment) const {
+    const auto& dictionary = *segment.dictionary();
+    const auto attribute_vector = segment.attribute_vector();
+
+    ValueID search_pos;
     switch (_scan_type) {
       case ScanType::OpEquals:
-        return [=](const T& value) -> bool { return value == _search_value; };
+        search_pos = segment.lower_bound(_search_value);
+        if (search_pos != INVALID_VALUE_ID && dictionary[search_pos] == _search_value) {
+          // If we find a lower bound candidate, and it is our _search_value,
+          // simply add all equal items of the attribute_vector.
+          add_to_pos_list<std::equal_to<>>(pos_list, chunk_id, attribute_vector, search_pos);
+        }
+        break;
+
       case ScanType::OpNotEquals:
-        return [=](const T& value) -> bool { return value != _search_value; };
+        search_pos = segment.lower_bound(_search_value);
+        if (search_pos != INVALID_VALUE_ID && dictionary[search_pos] == _search_value) {
+          // If we find a lower bound candidate, and it is our _search_value,
+          // simply add all non-equal items of the attribute_vector.
+          add_to_pos_list<std::not_equal_to<>>(pos_list, chunk_id, attribute_vector, search_pos);
+        } else {
+          // else our _search_value is not in the dictionary, so add all.
+          add_all_to_pos_list(pos_list, chunk_id, attribute_vector);
+        }
+        break;
+
       case ScanType::OpLessThan:
-        return [=](const T& value) -> bool { return value < _search_value; };
+        search_pos = segment.lower_bound(_search_value);
+        if (search_pos != INVALID_VALUE_ID) {
+          // All ValueIDs below the first value >= _search_value refer to smaller values.
+          add_to_pos_list<std::less<>>(pos_list, chunk_id, attribute_vector, search_pos);
+        } else {
+          // Else, even the greatest value in our dictionary is smaller than our _search_value, so add all.
+          add_all_to_pos_list(pos_list, chunk_id, attribute_vector);
+        }
+        break;
+
       case ScanType::OpLessThanEquals:
-        return [=](const T& value) -> bool { return value <= _search_value; };
+        search_pos = segment.upper_bound(_search_value);
+        if (search_pos != INVALID_VALUE_ID) {
+          // All ValueIDs below the first value > _search_value refer to smaller or equal values.
+          add_to_pos_list<std::less<>>(pos_list, chunk_id, attribute_vector, search_pos);
+        } else {
+          // Else, no value in our dictionary is greater than our _search_value, so add all.
+          add_all_to_pos_list(pos_list, chunk_id, attribute_vector);
+        }
+        break;
+
       case ScanType::OpGreaterThan:
-        return [=](const T& value) -> bool { return value > _search_value; };
+        search_pos = segment.upper_bound(_search_value);
+        if (search_pos != INVALID_VALUE_ID) {
+          // The first value > _search_value and all following ones qualify.
+          add_to_pos_list<std::greater_equal<>>(pos_list, chunk_id, attribute_vector, search_pos);
+        }
+        break;
+
       case ScanType::OpGreaterThanEquals:
-        return [=](const T& value) -> bool { return value >= _search_value; };
+        search_pos = segment.lower_bound(_search_value);
+        if (search_pos != INVALID_VALUE_ID) {
+          // The first value >= _search_value and all following ones qualify.
+          add_to_pos_list<std::greater_equal<>>(pos_list, chunk_id, attribute_vector, search_pos);
+        }
+        break;
+
       default:
-        Fail("Unrecognized ScanType");
-        // compiler complains that nothing is returned otherwise
-        return [=](const T& value) -> bool { return false; };
+        Fail("Unreconigzed ScanType");
+    }
+  }
+
+  // Rewrites the search value into the offset space of each block, so that the bit-packed offsets can be compared
+  // without adding the block minimum to every value first.
+  void _scan_frame_of_reference_segment(PosList& pos_list, const ChunkID chunk_id,
+                                        const FrameOfReferenceSegment<T>& segment) const {
+    // frame-of-reference segments only exist for integral types
+    if constexpr (std::is_integral_v<T>) {
+      using UnsignedT = std::make_unsigned_t<T>;
+
+      const auto& block_minima = *segment.block_minima();
+      const auto& offsets = *segment.offsets();
+      const auto max_offset = (uint64_t{1} << offsets.bit_width()) - 1;
+
+      // Which rows match if the search value lies below or above all values that the block can represent
+      const auto all_rows_match_if_below = _scan_type == ScanType::OpNotEquals ||
+                                           _scan_type == ScanType::OpGreaterThan ||
+                                           _scan_type == ScanType::OpGreaterThanEquals;
+      const auto all_rows_match_if_above = _scan_type == ScanType::OpNotEquals || _scan_type == ScanType::OpLessThan ||
+                                           _scan_type == ScanType::OpLessThanEquals;
+
+      std::vector<ValueID::base_type> block;
+      for (size_t block_index = 0; block_index < block_minima.size(); ++block_index) {
+        const auto block_begin = static_cast<ChunkOffset>(block_index * FrameOfReferenceSegment<T>::BLOCK_SIZE);
+        const auto block_end = static_cast<ChunkOffset>(
+            std::min(size_t{block_begin + FrameOfReferenceSegment<T>::BLOCK_SIZE}, segment.size()));
+        const auto minimum = block_minima[block_index];
+
+        if (_search_value < minimum) {
+          if (all_rows_match_if_below) add_range_to_pos_list(pos_list, chunk_id, block_begin, block_end);
+          continue;
+        }
+
+        const auto search_offset = static_cast<UnsignedT>(_search_value) - static_cast<UnsignedT>(minimum);
+        if (search_offset > max_offset) {
+          if (all_rows_match_if_above) add_range_to_pos_list(pos_list, chunk_id, block_begin, block_end);
+          continue;
+        }
+
+        block.resize(block_end - block_begin);
+        offsets.decode_into(block_begin, block);
+        // offsets are compared in the same way as value ids
+        const auto search_pos = ValueID{static_cast<ValueID::base_type>(search_offset)};
+        with_comparator(_scan_type, [&](const auto compare) {
+          add_matching_value_ids_to_pos_list<decltype(compare)>(pos_list, chunk_id, block, block_begin, search_pos);
+        });
+      }
     }
   }
 };
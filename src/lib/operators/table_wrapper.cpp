@@ -9,4 +9,9 @@ namespace opossum {
 TableWrapper::TableWrapper(const std::shared_ptr<const Table> table) : _table(table) {}
 
 std::shared_ptr<const Table> TableWrapper::_on_execute() { return _table; }
+
+bool TableWrapper::_creates_output() const { return false; }
+
+const std::string TableWrapper::name() const { return "TableWrapper"; }
+
 }  // namespace opossum
@@ -0,0 +1,149 @@
+#include "top_n.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "operator_utils.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TopN::TopN(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t n)
+    : AbstractOperator(in), _sort_definitions(sort_definitions), _n(n) {
+  Assert(!_sort_definitions.empty(), "TopN requires at least one sort column");
+}
+
+const std::string TopN::name() const { return "TopN"; }
+
+const std::vector<SortColumnDefinition>& TopN::sort_definitions() const { return _sort_definitions; }
+
+size_t TopN::n() const { return _n; }
+
+std::shared_ptr<const Table> TopN::_on_execute() {
+  const auto input_table = _input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  std::vector<std::shared_ptr<const BaseSegment>> string_segments;
+  const auto sort_columns = make_sort_columns(*input_table, _sort_definitions, string_segments);
+
+  // Rows that are equal in all sort columns are ordered by their RowIDs, as in the output of the stable Sort
+  const auto row_less = [&](const RowID& lhs, const RowID& rhs) {
+    const auto result = compare_rows(sort_columns, lhs, rhs);
+    return result < 0 || (result == 0 && lhs < rhs);
+  };
+
+  // Each job finds the top rows of one chunk, in order
+  std::vector<PosList> chunk_top_rows(chunk_count);
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (_n == 0 || input_table->get_chunk(chunk_id).size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& chunk = input_table->get_chunk(chunk_id);
+      const auto chunk_size = chunk.size();
+      sort_columns.front()->materialize_chunk(chunk, chunk_id);
+
+      // A max-heap of the best rows so far, whose top is the row that is replaced first
+      auto& heap = chunk_top_rows[chunk_id];
+      heap.reserve(std::min(_n, static_cast<size_t>(chunk_size)));
+      const auto add_to_heap = [&](const ChunkOffset chunk_offset) {
+        const auto row_id = RowID{chunk_id, chunk_offset};
+        if (heap.size() < _n) {
+          heap.emplace_back(row_id);
+          std::push_heap(heap.begin(), heap.end(), row_less);
+        } else if (row_less(row_id, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), row_less);
+          heap.back() = row_id;
+          std::push_heap(heap.begin(), heap.end(), row_less);
+        }
+      };
+
+      const auto value_ids = sort_columns.front()->value_ids(chunk_id);
+      if (!value_ids || _n >= chunk_size) {
+        for (auto sort_column = sort_columns.cbegin() + 1; sort_column != sort_columns.cend(); ++sort_column) {
+          (*sort_column)->materialize_chunk(chunk, chunk_id);
+        }
+        for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          add_to_heap(chunk_offset);
+        }
+      } else {
+        // The best n rows of the chunk have the first ValueIDs in sort order that together occur at least n times.
+        // All other rows are skipped.
+        std::vector<ChunkOffset> value_id_counts(*std::max_element(value_ids->cbegin(), value_ids->cend()) + 1);
+        for (const auto value_id : *value_ids) {
+          ++value_id_counts[value_id];
+        }
+
+        const auto ascending = _sort_definitions.front().order_by_mode == OrderByMode::Ascending;
+        auto last_value_id = ascending ? ValueID::base_type{0}
+                                       : static_cast<ValueID::base_type>(value_id_counts.size() - 1);
+        for (auto row_count = size_t{value_id_counts[last_value_id]}; row_count < _n;
+             row_count += value_id_counts[last_value_id]) {
+          if (ascending) {
+            ++last_value_id;
+          } else {
+            --last_value_id;
+          }
+        }
+
+        std::vector<ChunkOffset> candidate_offsets;
+        for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          const auto value_id = (*value_ids)[chunk_offset];
+          if (ascending ? value_id <= last_value_id : value_id >= last_value_id) {
+            candidate_offsets.emplace_back(chunk_offset);
+          }
+        }
+
+        // Only the remaining rows need the keys of the other sort columns
+        for (auto sort_column = sort_columns.cbegin() + 1; sort_column != sort_columns.cend(); ++sort_column) {
+          (*sort_column)->materialize_chunk(chunk, chunk_id, candidate_offsets);
+        }
+        for (const auto chunk_offset : candidate_offsets) {
+          add_to_heap(chunk_offset);
+        }
+      }
+
+      std::sort_heap(heap.begin(), heap.end(), row_less);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // Merges the ordered top rows of all chunks until n rows are found, using a heap of the next row of each chunk
+  std::vector<size_t> next_positions(chunk_count);
+  const auto comes_after = [&](const ChunkID lhs, const ChunkID rhs) {
+    return row_less(chunk_top_rows[rhs][next_positions[rhs]], chunk_top_rows[lhs][next_positions[lhs]]);
+  };
+  std::priority_queue<ChunkID, std::vector<ChunkID>, decltype(comes_after)> heap{comes_after};
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!chunk_top_rows[chunk_id].empty()) heap.push(chunk_id);
+  }
+
+  auto pos_list = std::make_shared<PosList>();
+  while (!heap.empty() && pos_list->size() < _n) {
+    const auto chunk_id = heap.top();
+    heap.pop();
+    pos_list->emplace_back(chunk_top_rows[chunk_id][next_positions[chunk_id]]);
+    if (++next_positions[chunk_id] < chunk_top_rows[chunk_id].size()) heap.push(chunk_id);
+  }
+
+  auto output_table = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_table->add_column_definition(input_table->column_name(column_id), input_table->column_type(column_id));
+  }
+  Chunk output_chunk;
+  add_reference_segments(output_chunk, input_table, pos_list);
+  output_table->emplace_chunk(output_chunk);
+
+  return output_table;
+}
+
+}  // namespace opossum
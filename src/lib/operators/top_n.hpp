@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Returns the first n rows of a table in the order of one or more columns, i.e., the same rows in the same order as
+// the first n rows of the output of Sort with the same sort definitions. The output consists of ReferenceSegments to
+// the input, like the output of TableScan.
+//
+// Each chunk is processed by its own job, which keeps its best n rows in a bounded heap. If the first sort column of a
+// chunk is a DictionarySegment, a histogram of its ValueIDs tells which ValueIDs the best n rows of the chunk can
+// have, and only the rows with these ValueIDs are considered for the heap. The other sort columns are then only
+// materialized for these rows. The heaps of all chunks are merged at the end.
+class TopN : public AbstractOperator {
+ public:
+  TopN(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t n);
+
+  const std::string name() const override;
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  size_t n() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::vector<SortColumnDefinition> _sort_definitions;
+  size_t _n;
+};
+
+}  // namespace opossum
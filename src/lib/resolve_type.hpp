@@ -7,11 +7,20 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "all_type_variant.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/base_attribute_vector.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fitted_attribute_vector.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -129,4 +138,82 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+/**
+ * Resolves the concrete type of an attribute vector by passing it, cast to its most derived type, on to a generic
+ * lambda. This allows loops over the attribute vector to be inlined and vectorized instead of calling the virtual
+ * BaseAttributeVector::get() for every position.
+ *
+ * @param attribute_vector is any attribute vector, e.g., one of a DictionarySegment
+ * @param func is a generic lambda or similar accepting a const reference to FittedAttributeVector<uint8_t>,
+ *             FittedAttributeVector<uint16_t>, FittedAttributeVector<uint32_t>, or BitPackedAttributeVector
+ *
+ *
+ * Example:
+ *
+ *   resolve_attribute_vector(*dictionary_segment->attribute_vector(), [&](const auto& typed_attribute_vector) {
+ *     using VectorType = std::decay_t<decltype(typed_attribute_vector)>;
+ *     if constexpr (std::is_same_v<VectorType, BitPackedAttributeVector>) {
+ *       typed_attribute_vector.decode_into(...);
+ *     } else {
+ *       for (const auto value_id : typed_attribute_vector.values()) { ... }
+ *     }
+ *   });
+ */
+template <typename Functor>
+void resolve_attribute_vector(const BaseAttributeVector& attribute_vector, const Functor& func) {
+  if (const auto vector_uint8 = dynamic_cast<const FittedAttributeVector<uint8_t>*>(&attribute_vector)) {
+    func(*vector_uint8);
+  } else if (const auto vector_uint16 = dynamic_cast<const FittedAttributeVector<uint16_t>*>(&attribute_vector)) {
+    func(*vector_uint16);
+  } else if (const auto vector_uint32 = dynamic_cast<const FittedAttributeVector<uint32_t>*>(&attribute_vector)) {
+    func(*vector_uint32);
+  } else if (const auto bit_packed_vector = dynamic_cast<const BitPackedAttributeVector*>(&attribute_vector)) {
+    func(*bit_packed_vector);
+  } else {
+    Fail("Unrecognized attribute vector type");
+  }
+}
+
+/**
+ * Resolves the encoding of a segment of data type T by passing it, cast to its most derived type, on to a generic
+ * lambda. Code that works on segments is thus instantiated once per encoding and can access the typed data directly
+ * instead of calling the virtual BaseSegment::operator[] for every position. Prefer segment_iterate (see
+ * storage/segment_iterate.hpp) if all values of a segment are needed.
+ *
+ * @param segment is any segment of the data type T
+ * @param func is a generic lambda or similar accepting a const reference to ValueSegment<T>, DictionarySegment<T>,
+ *             RunLengthSegment<T>, FrameOfReferenceSegment<T> (only for int32_t and int64_t), or ReferenceSegment
+ *
+ *
+ * Example:
+ *
+ *   resolve_segment_type<T>(*chunk.get_segment(column_id), [&](const auto& typed_segment) {
+ *     using SegmentType = std::decay_t<decltype(typed_segment)>;
+ *     if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+ *       for (const auto& value : typed_segment.values()) { ... }
+ *     } else { ... }
+ *   });
+ */
+template <typename T, typename Functor>
+void resolve_segment_type(const BaseSegment& segment, const Functor& func) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    func(*value_segment);
+  } else if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    func(*dictionary_segment);
+  } else if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    func(*reference_segment);
+  } else if (const auto run_length_segment = dynamic_cast<const RunLengthSegment<T>*>(&segment)) {
+    func(*run_length_segment);
+  } else {
+    // frame-of-reference segments only exist for integral types
+    if constexpr (std::is_integral_v<T>) {
+      if (const auto frame_of_reference_segment = dynamic_cast<const FrameOfReferenceSegment<T>*>(&segment)) {
+        func(*frame_of_reference_segment);
+        return;
+      }
+    }
+    Fail("Unrecognized segment type");
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,98 @@
+#include "abstract_task.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "current_scheduler.hpp"
+#include "task_scheduler.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::atomic<TaskID> next_task_id{0};
+
+}  // namespace
+
+AbstractTask::AbstractTask() : _id(next_task_id++) {}
+
+TaskID AbstractTask::id() const { return _id; }
+
+bool AbstractTask::is_ready() const { return _pending_predecessor_count == 0; }
+
+bool AbstractTask::is_done() const { return _is_done; }
+
+bool AbstractTask::is_scheduled() const { return _is_scheduled; }
+
+void AbstractTask::set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor) {
+  Assert(!_is_scheduled && !successor->_is_scheduled, "Dependencies have to be set before tasks are scheduled");
+  _successors.push_back(successor);
+  ++successor->_pending_predecessor_count;
+}
+
+const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() const { return _successors; }
+
+void AbstractTask::schedule() {
+  Assert(!_is_scheduled.exchange(true), "Task was already scheduled");
+  _enqueue_if_ready();
+}
+
+void AbstractTask::join() {
+  std::unique_lock<std::mutex> lock(_done_mutex);
+  _done_condition.wait(lock, [&]() { return static_cast<bool>(_is_done); });
+}
+
+void AbstractTask::execute() {
+  DebugAssert(is_ready(), "Task must not be executed before its predecessors are done");
+
+  // The inputs of a task whose predecessor failed are missing, e.g., the output of an input operator
+  if (!_has_failed_predecessor) {
+    try {
+      _on_execute();
+    } catch (...) {
+      _exception = std::current_exception();
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_done_mutex);
+    _is_done = true;
+  }
+  _done_condition.notify_all();
+
+  for (const auto& successor : _successors) {
+    successor->_on_predecessor_done(_exception);
+  }
+}
+
+void AbstractTask::rethrow_exception() const {
+  if (_exception) {
+    std::rethrow_exception(_exception);
+  }
+}
+
+void AbstractTask::_on_predecessor_done(const std::exception_ptr& exception) {
+  // The exception is written before the count is decremented, so it is visible to whoever executes this task
+  if (exception && !_has_failed_predecessor.exchange(true)) {
+    _exception = exception;
+  }
+  --_pending_predecessor_count;
+  _enqueue_if_ready();
+}
+
+void AbstractTask::_enqueue_if_ready() {
+  // Both schedule() and the last finishing predecessor may get here at the same time, only one of them enqueues
+  if (!_is_scheduled || !is_ready() || _is_enqueued.exchange(true)) {
+    return;
+  }
+
+  // A task whose predecessor failed is only marked as done, which does not need a worker
+  if (CurrentScheduler::is_set() && !_has_failed_predecessor) {
+    CurrentScheduler::get()->enqueue(shared_from_this());
+  } else {
+    execute();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// A task is a unit of work that is executed by the workers of the CurrentScheduler. Tasks can depend on other tasks:
+// a task is only executed once all of its predecessors are done. Without an active scheduler, a task is executed by
+// the thread that schedules it (or that finishes its last predecessor).
+//
+// Exceptions thrown during the execution are stored and rethrown by CurrentScheduler::wait_for_tasks. The successors
+// of a failed task are not executed but only marked as done, and they pass the exception on.
+class AbstractTask : public std::enable_shared_from_this<AbstractTask>, private Noncopyable {
+ public:
+  AbstractTask();
+  virtual ~AbstractTask() = default;
+
+  // unique within the process, mainly helpful for debugging
+  TaskID id() const;
+
+  // a task is ready when all of its predecessors are done
+  bool is_ready() const;
+  bool is_done() const;
+  bool is_scheduled() const;
+
+  // Makes this task a predecessor of the given task, i.e., the successor is not executed before this task is done.
+  // Dependencies have to be set up before either task is scheduled.
+  void set_as_predecessor_of(const std::shared_ptr<AbstractTask>& successor);
+
+  const std::vector<std::shared_ptr<AbstractTask>>& successors() const;
+
+  // Hands the task over to the CurrentScheduler, which executes it as soon as it is ready. Can only be called once.
+  void schedule();
+
+  // Blocks until the task is done. Use CurrentScheduler::wait_for_tasks instead, which also rethrows exceptions and
+  // lets workers execute other tasks in the meantime.
+  void join();
+
+  // Executes the task in the calling thread. This is called by the workers and should not be called directly.
+  void execute();
+
+  // rethrows the exception that happened during the execution, if any
+  void rethrow_exception() const;
+
+ protected:
+  virtual void _on_execute() = 0;
+
+ private:
+  // the exception is that of the predecessor if it failed, nullptr otherwise
+  void _on_predecessor_done(const std::exception_ptr& exception);
+
+  // passes the task to the scheduler (or executes it) exactly once, after it has been scheduled and became ready
+  void _enqueue_if_ready();
+
+  const TaskID _id;
+
+  std::vector<std::shared_ptr<AbstractTask>> _successors;
+  std::atomic<uint32_t> _pending_predecessor_count{0};
+
+  std::atomic_bool _is_scheduled{false};
+  std::atomic_bool _is_enqueued{false};
+  std::atomic_bool _is_done{false};
+
+  // Set by the task itself or by the first failed predecessor, in which case the task is not executed
+  std::exception_ptr _exception;
+  std::atomic_bool _has_failed_predecessor{false};
+
+  std::mutex _done_mutex;
+  std::condition_variable _done_condition;
+};
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#include "current_scheduler.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_scheduler.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+std::shared_ptr<TaskScheduler> CurrentScheduler::_instance;
+
+const std::shared_ptr<TaskScheduler>& CurrentScheduler::get() { return _instance; }
+
+void CurrentScheduler::set(const std::shared_ptr<TaskScheduler>& scheduler) { _instance = scheduler; }
+
+bool CurrentScheduler::is_set() { return _instance != nullptr; }
+
+void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  if (const auto worker = Worker::get_this_thread_worker()) {
+    worker->wait_for_tasks(tasks);
+  } else {
+    for (const auto& task : tasks) {
+      task->join();
+    }
+  }
+
+  for (const auto& task : tasks) {
+    task->rethrow_exception();
+  }
+}
+
+void CurrentScheduler::schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+  wait_for_tasks(tasks);
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+class AbstractTask;
+class TaskScheduler;
+
+// Holds the TaskScheduler that tasks are passed to. If no scheduler is set, tasks are executed right away by the
+// thread that schedules them, so the jobs of an operator run one after another. Executables therefore set a scheduler
+// at startup, and the tests run with one as well.
+//
+//   CurrentScheduler::set(std::make_shared<TaskScheduler>());
+//   CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(plan_root));
+//   CurrentScheduler::get()->finish();
+//   CurrentScheduler::set(nullptr);
+//
+// The scheduler should only be changed while no tasks are running.
+class CurrentScheduler {
+ public:
+  static const std::shared_ptr<TaskScheduler>& get();
+  static void set(const std::shared_ptr<TaskScheduler>& scheduler);
+  static bool is_set();
+
+  // Blocks until all tasks are done. If called by a worker, the worker executes other tasks in the meantime. The first
+  // exception that happened in any of the tasks is rethrown.
+  static void wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+  // Schedules all tasks, e.g., the tasks of an operator DAG or the jobs of an operator, and waits for them
+  static void schedule_and_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ private:
+  static std::shared_ptr<TaskScheduler> _instance;
+};
+
+}  // namespace opossum
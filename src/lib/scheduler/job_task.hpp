@@ -0,0 +1,27 @@
+#pragma once
+
+#include <functional>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+// A task that runs an arbitrary function, used by operators and storage code to split their work into jobs, e.g.:
+//
+//   std::vector<std::shared_ptr<AbstractTask>> jobs;
+//   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+//     jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() { process(chunk_id); }));
+//   }
+//   CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+class JobTask : public AbstractTask {
+ public:
+  explicit JobTask(const std::function<void()>& function);
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  std::function<void()> _function;
+};
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#include "operator_task.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::shared_ptr<AbstractTask> add_operator_tasks(
+    const std::shared_ptr<AbstractOperator>& op,
+    std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>>& task_by_operator,
+    std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  if (const auto it = task_by_operator.find(op); it != task_by_operator.end()) {
+    return it->second;
+  }
+
+  const auto task = std::make_shared<OperatorTask>(op);
+  for (const auto& input : {op->input_left(), op->input_right()}) {
+    if (input) {
+      // Operators only hold their inputs as const, but executing them is what the plan is built for
+      const auto input_task =
+          add_operator_tasks(std::const_pointer_cast<AbstractOperator>(input), task_by_operator, tasks);
+      input_task->set_as_predecessor_of(task);
+    }
+  }
+
+  task_by_operator.emplace(op, task);
+  tasks.push_back(task);
+  return task;
+}
+
+}  // namespace
+
+OperatorTask::OperatorTask(const std::shared_ptr<AbstractOperator>& op) : _op(op) {}
+
+std::vector<std::shared_ptr<AbstractTask>> OperatorTask::make_tasks_from_operator(
+    const std::shared_ptr<AbstractOperator>& op) {
+  std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractTask>> task_by_operator;
+  std::vector<std::shared_ptr<AbstractTask>> tasks;
+  add_operator_tasks(op, task_by_operator, tasks);
+  return tasks;
+}
+
+const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
+
+void OperatorTask::_on_execute() { _op->execute(); }
+
+}  // namespace opossum
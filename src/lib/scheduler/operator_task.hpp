@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+// Executes an operator. The tasks of an operator's inputs are its predecessors, so that a plan is executed in
+// dependency order and independent subtrees run concurrently.
+class OperatorTask : public AbstractTask {
+ public:
+  explicit OperatorTask(const std::shared_ptr<AbstractOperator>& op);
+
+  // Creates the tasks for an operator and all of its direct and indirect inputs. An operator that is the input of
+  // several others gets a single task. Predecessors come first in the result, the task of op is the last one.
+  static std::vector<std::shared_ptr<AbstractTask>> make_tasks_from_operator(
+      const std::shared_ptr<AbstractOperator>& op);
+
+  const std::shared_ptr<AbstractOperator>& get_operator() const;
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  std::shared_ptr<AbstractOperator> _op;
+};
+
+}  // namespace opossum
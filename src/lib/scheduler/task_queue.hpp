@@ -0,0 +1,32 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+// The queue of ready tasks of a single worker. The worker itself takes the most recently added task, which is likely
+// still in its caches, while other workers steal the oldest one.
+class TaskQueue : private Noncopyable {
+ public:
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  // returns the most recently pushed task, or nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> pull();
+
+  // returns the least recently pushed task, or nullptr if the queue is empty
+  std::shared_ptr<AbstractTask> steal();
+
+  bool empty() const;
+
+ private:
+  std::deque<std::shared_ptr<AbstractTask>> _tasks;
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#include "task_scheduler.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+#include "worker.hpp"
+
+namespace opossum {
+
+TaskScheduler::TaskScheduler(size_t worker_count) {
+  worker_count = std::max(worker_count, size_t{1});
+  for (WorkerID worker_id = 0; worker_id < worker_count; ++worker_id) {
+    _workers.emplace_back(std::make_unique<Worker>(*this, worker_id));
+  }
+
+  // Workers are only started once all of them exist, as they steal from each other
+  for (const auto& worker : _workers) {
+    worker->start();
+  }
+}
+
+TaskScheduler::~TaskScheduler() {
+  if (!_is_shut_down) {
+    finish();
+  }
+}
+
+void TaskScheduler::enqueue(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(!_is_shut_down, "Cannot enqueue tasks after the scheduler was finished");
+  ++_unfinished_task_count;
+
+  // The task is counted before it can be pulled, so that the count never drops below the number of queued tasks. A
+  // worker that sees the count before the push is done only retries. Counting under the lock makes sure that a worker
+  // cannot check the count and go to sleep between the increment and the notification.
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_queued_task_count;
+  }
+
+  // Tasks created by a worker, e.g., the jobs of an operator, are likely to use the same data as that worker
+  const auto this_thread_worker = Worker::get_this_thread_worker();
+  if (this_thread_worker && this_thread_worker->id() < _workers.size() &&
+      _workers[this_thread_worker->id()].get() == this_thread_worker) {
+    this_thread_worker->queue().push(task);
+  } else {
+    _workers[_next_worker_id++ % _workers.size()]->queue().push(task);
+  }
+  _enqueued_condition.notify_one();
+}
+
+void TaskScheduler::finish() {
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _finished_condition.wait(lock, [&]() { return _unfinished_task_count == 0; });
+    _is_shut_down = true;
+  }
+  _enqueued_condition.notify_all();
+
+  for (const auto& worker : _workers) {
+    worker->join();
+  }
+}
+
+const std::vector<std::unique_ptr<Worker>>& TaskScheduler::workers() const { return _workers; }
+
+std::shared_ptr<AbstractTask> TaskScheduler::pull_task(WorkerID worker_id) {
+  auto task = _workers[worker_id]->queue().pull();
+  for (size_t offset = 1; !task && offset < _workers.size(); ++offset) {
+    task = _workers[(worker_id + offset) % _workers.size()]->queue().steal();
+  }
+
+  if (task) {
+    --_queued_task_count;
+  }
+  return task;
+}
+
+void TaskScheduler::on_task_executed() {
+  if (--_unfinished_task_count == 0) {
+    // Lock so that finish() cannot miss the notification between checking the count and waiting
+    std::lock_guard<std::mutex> lock(_mutex);
+    _finished_condition.notify_all();
+  }
+}
+
+void TaskScheduler::wait_for_enqueued_tasks() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  _enqueued_condition.wait(lock, [&]() { return _queued_task_count > 0 || _is_shut_down; });
+}
+
+bool TaskScheduler::is_shut_down() const { return _is_shut_down; }
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class Worker;
+
+// A work-stealing thread pool with one worker per core by default. Tasks that are enqueued by a worker go to that
+// worker's queue, all other tasks are distributed round-robin. Idle workers steal tasks from the other queues.
+// Tasks do not use the TaskScheduler directly but the one set in CurrentScheduler.
+class TaskScheduler : private Noncopyable {
+ public:
+  explicit TaskScheduler(size_t worker_count = std::thread::hardware_concurrency());
+
+  // finishes the scheduler if that has not been done yet
+  ~TaskScheduler();
+
+  // adds a ready task to a queue, called by AbstractTask once the task is scheduled and ready
+  void enqueue(const std::shared_ptr<AbstractTask>& task);
+
+  // Waits until all enqueued tasks, including those that they enqueue, are done and stops the workers. Tasks must not
+  // be enqueued afterwards.
+  void finish();
+
+  const std::vector<std::unique_ptr<Worker>>& workers() const;
+
+  // The following methods are used by the workers
+  // returns a task of the worker's own queue or, if that is empty, one stolen from another queue
+  std::shared_ptr<AbstractTask> pull_task(WorkerID worker_id);
+  void on_task_executed();
+  // blocks until a task is queued or the scheduler is shut down
+  void wait_for_enqueued_tasks();
+  bool is_shut_down() const;
+
+ private:
+  std::vector<std::unique_ptr<Worker>> _workers;
+  std::atomic<size_t> _next_worker_id{0};
+
+  // number of tasks in the queues and number of tasks that were enqueued but are not done yet
+  std::atomic<size_t> _queued_task_count{0};
+  std::atomic<size_t> _unfinished_task_count{0};
+  std::atomic_bool _is_shut_down{false};
+
+  std::mutex _mutex;
+  std::condition_variable _enqueued_condition;
+  std::condition_variable _finished_condition;
+};
+
+}  // namespace opossum
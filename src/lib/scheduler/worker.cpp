@@ -0,0 +1,68 @@
+#include "worker.hpp"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_scheduler.hpp"
+
+namespace opossum {
+
+namespace {
+
+thread_local Worker* this_thread_worker = nullptr;
+
+}  // namespace
+
+Worker* Worker::get_this_thread_worker() { return this_thread_worker; }
+
+Worker::Worker(TaskScheduler& scheduler, WorkerID id) : _scheduler(scheduler), _id(id) {}
+
+WorkerID Worker::id() const { return _id; }
+
+TaskQueue& Worker::queue() { return _queue; }
+
+void Worker::start() { _thread = std::thread(&Worker::_work, this); }
+
+void Worker::join() { _thread.join(); }
+
+void Worker::wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks) {
+  for (const auto& task : tasks) {
+    while (!task->is_done()) {
+      if (!_execute_next_task()) {
+        // The remaining tasks are being executed by other workers
+        std::this_thread::yield();
+      }
+    }
+  }
+}
+
+void Worker::_work() {
+  this_thread_worker = this;
+
+  while (true) {
+    if (_execute_next_task()) {
+      continue;
+    }
+    if (_scheduler.is_shut_down()) {
+      break;
+    }
+    _scheduler.wait_for_enqueued_tasks();
+  }
+
+  this_thread_worker = nullptr;
+}
+
+bool Worker::_execute_next_task() {
+  const auto task = _scheduler.pull_task(_id);
+  if (!task) {
+    return false;
+  }
+
+  task->execute();
+  _scheduler.on_task_executed();
+  return true;
+}
+
+}  // namespace opossum
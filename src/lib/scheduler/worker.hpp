@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "task_queue.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class TaskScheduler;
+
+// A worker owns a thread and a TaskQueue. It executes the tasks of its own queue and steals tasks from the queues of
+// the other workers once its own queue is empty.
+class Worker : private Noncopyable {
+ public:
+  // returns the worker that runs the calling thread, or nullptr if the thread does not belong to a worker
+  static Worker* get_this_thread_worker();
+
+  Worker(TaskScheduler& scheduler, WorkerID id);
+
+  WorkerID id() const;
+  TaskQueue& queue();
+
+  void start();
+  void join();
+
+  // Executes other tasks until all of the given tasks are done. This keeps the worker busy while, e.g., an operator
+  // waits for the jobs it has scheduled, and prevents deadlocks when all workers are waiting.
+  void wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& tasks);
+
+ private:
+  void _work();
+
+  // executes a task from the own queue or from another worker's queue and returns false if there was none
+  bool _execute_next_task();
+
+  TaskScheduler& _scheduler;
+  const WorkerID _id;
+  TaskQueue _queue;
+  std::thread _thread;
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "types.hpp"
 
 namespace opossum {
@@ -25,7 +27,14 @@ class BaseAttributeVector : private Noncopyable {
   // returns the number of values
   virtual size_t size() const = 0;
 
+  // returns an estimate of the number of bytes the attribute vector occupies
+  virtual size_t estimate_memory_usage() const = 0;
+
   // returns the width of biggest value id in bytes
   virtual AttributeVectorWidth width() const = 0;
+
+  // writes output.size() value ids starting at position start into output
+  // prefer this over calling get() for every position, or use resolve_attribute_vector to access the typed vector
+  virtual void decode_into(const size_t start, std::vector<ValueID::base_type>& output) const = 0;
 };
 }  // namespace opossum
@@ -28,5 +28,10 @@ class BaseSegment : private Noncopyable {
 
   // returns the number of values
   virtual size_t size() const = 0;
+
+  // returns an estimate of the number of bytes the segment occupies, including the data it owns. Data that is shared
+  // with other segments, such as the position list of a ReferenceSegment, is counted for every segment. Chunk and
+  // Table count shared position lists once.
+  virtual size_t estimate_memory_usage() const = 0;
 };
 }  // namespace opossum
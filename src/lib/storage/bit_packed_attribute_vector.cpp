@@ -0,0 +1,121 @@
+#include "bit_packed_attribute_vector.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr uint8_t WORD_BITS = 32;
+
+uint64_t load_two_words(const std::vector<uint32_t>& data, const size_t word_index) {
+  uint64_t two_words;
+  std::memcpy(&two_words, &data[word_index], sizeof(two_words));
+  return two_words;
+}
+
+uint32_t mask_for_bit_width(const uint8_t bit_width) {
+  return static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+}
+
+}  // namespace
+
+BitPackedAttributeVector::BitPackedAttributeVector(const uint8_t bit_width, const size_t size)
+    : _bit_width(bit_width), _size(size) {
+  Assert(bit_width > 0 && bit_width <= WORD_BITS, "Bit width must be between 1 and 32.");
+  _data.resize((size * bit_width + WORD_BITS - 1) / WORD_BITS + 1);
+}
+
+ValueID BitPackedAttributeVector::get(const size_t i) const {
+  const auto bit_offset = i * _bit_width;
+  const auto two_words = load_two_words(_data, bit_offset / WORD_BITS);
+  return ValueID{static_cast<uint32_t>(two_words >> (bit_offset % WORD_BITS)) & mask_for_bit_width(_bit_width)};
+}
+
+void BitPackedAttributeVector::set(const size_t i, const ValueID value_id) {
+  DebugAssert(value_id <= mask_for_bit_width(_bit_width), "ValueID must fit within bit width.");
+  const auto bit_offset = i * _bit_width;
+  const auto word_index = bit_offset / WORD_BITS;
+  const auto shift = bit_offset % WORD_BITS;
+
+  auto two_words = load_two_words(_data, word_index);
+  two_words &= ~(uint64_t{mask_for_bit_width(_bit_width)} << shift);
+  two_words |= uint64_t{value_id} << shift;
+  std::memcpy(&_data[word_index], &two_words, sizeof(two_words));
+}
+
+size_t BitPackedAttributeVector::size() const { return _size; }
+
+size_t BitPackedAttributeVector::estimate_memory_usage() const {
+  return sizeof(*this) + _data.capacity() * sizeof(uint32_t);
+}
+
+AttributeVectorWidth BitPackedAttributeVector::width() const { return AttributeVectorWidth((_bit_width + 7) / 8); }
+
+uint8_t BitPackedAttributeVector::bit_width() const { return _bit_width; }
+
+void BitPackedAttributeVector::decode_into(const size_t start, std::vector<ValueID::base_type>& output) const {
+  DebugAssert(start + output.size() <= _size, "Cannot decode past the end of the attribute vector.");
+  const auto mask = mask_for_bit_width(_bit_width);
+  const auto count = output.size();
+  size_t index = 0;
+
+#if defined(__AVX2__)
+  // Decodes eight values at once: each lane gathers the word its value starts in and the following word, shifts both
+  // into place, and masks the result. Variable shifts by 32 yield zero, which covers values that fit into one word.
+  const auto lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const auto bit_width_vector = _mm256_set1_epi32(_bit_width);
+  const auto word_bits_vector = _mm256_set1_epi32(WORD_BITS);
+  const auto shift_mask_vector = _mm256_set1_epi32(WORD_BITS - 1);
+  const auto mask_vector = _mm256_set1_epi32(static_cast<int32_t>(mask));
+
+  for (; index + 8 <= count; index += 8) {
+    const auto base_bit_offset = (start + index) * _bit_width;
+    const auto base_word = reinterpret_cast<const int*>(_data.data() + base_bit_offset / WORD_BITS);
+
+    const auto bit_offsets = _mm256_add_epi32(_mm256_mullo_epi32(lanes, bit_width_vector),
+                                              _mm256_set1_epi32(static_cast<int32_t>(base_bit_offset % WORD_BITS)));
+    const auto word_indices = _mm256_srli_epi32(bit_offsets, 5);
+    const auto shifts = _mm256_and_si256(bit_offsets, shift_mask_vector);
+
+    const auto low_words = _mm256_i32gather_epi32(base_word, word_indices, 4);
+    const auto high_words = _mm256_i32gather_epi32(base_word + 1, word_indices, 4);
+
+    const auto values = _mm256_and_si256(_mm256_or_si256(_mm256_srlv_epi32(low_words, shifts),
+                                                         _mm256_sllv_epi32(high_words,
+                                                                           _mm256_sub_epi32(word_bits_vector, shifts))),
+                                         mask_vector);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output.data() + index), values);
+  }
+#endif
+
+  for (; index < count; ++index) {
+    const auto bit_offset = (start + index) * _bit_width;
+    const auto two_words = load_two_words(_data, bit_offset / WORD_BITS);
+    output[index] = static_cast<uint32_t>(two_words >> (bit_offset % WORD_BITS)) & mask;
+  }
+}
+
+uint8_t bit_width_for_dictionary_size(size_t dictionary_size) {
+  Assert(dictionary_size <= std::numeric_limits<uint32_t>::max(), "Dictionary size is too large.");
+  uint8_t bit_width = 1;
+  while ((uint64_t{1} << bit_width) < dictionary_size) {
+    ++bit_width;
+  }
+  return bit_width;
+}
+
+std::shared_ptr<BaseAttributeVector> make_bit_packed_attribute_vector(size_t dictionary_size, size_t segment_size) {
+  return std::make_shared<BitPackedAttributeVector>(bit_width_for_dictionary_size(dictionary_size), segment_size);
+}
+
+}  // namespace opossum
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// An AttributeVector that stores each ValueID with exactly as many bits as are needed to represent the largest
+// ValueID of the dictionary, i.e., ceil(log2(dictionary size)) bits. Values are packed back to back into 32-bit words,
+// so a single value may span two words.
+class BitPackedAttributeVector : public BaseAttributeVector {
+ public:
+  BitPackedAttributeVector(const uint8_t bit_width, const size_t size);
+
+  // returns the value id at a given position
+  ValueID get(const size_t i) const override;
+
+  // sets the value id at a given position
+  void set(const size_t i, const ValueID value_id) override;
+
+  // returns the number of values
+  size_t size() const override;
+
+  // returns an estimate of the number of bytes the attribute vector occupies
+  size_t estimate_memory_usage() const override;
+
+  // returns the width of biggest value id in bytes, rounded up
+  AttributeVectorWidth width() const override;
+
+  // returns the number of bits used per value id
+  uint8_t bit_width() const;
+
+  // unpacks output.size() value ids starting at position start into output. This is considerably faster than calling
+  // get() for each position and uses AVX2 if the library is compiled with support for it.
+  void decode_into(const size_t start, std::vector<ValueID::base_type>& output) const override;
+
+ protected:
+  uint8_t _bit_width;
+  size_t _size;
+  // one additional word of padding allows reading two consecutive words for every value
+  std::vector<uint32_t> _data;
+};
+
+// returns the minimal number of bits that are needed to store the ValueIDs of a dictionary of the given size
+uint8_t bit_width_for_dictionary_size(size_t dictionary_size);
+
+std::shared_ptr<BaseAttributeVector> make_bit_packed_attribute_vector(size_t dictionary_size, size_t segment_size);
+
+}  // namespace opossum
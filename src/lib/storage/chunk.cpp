@@ -9,12 +9,17 @@
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "reference_segment.hpp"
+#include "segment_statistics.hpp"
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) { _segments.push_back(segment); }
+void Chunk::add_segment(std::shared_ptr<BaseSegment> segment) {
+  _segments.push_back(segment);
+  _statistics.push_back(nullptr);
+}
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert((values.size() == _segments.size()), "Column and value count must be the same");
@@ -23,15 +28,52 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
-std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const { return _segments[column_id]; }
+// Segments and statistics can be replaced while other threads read them (see Table::compress_chunk), which is why they
+// are always accessed through the atomic shared_ptr functions
+std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
+  return std::atomic_load(&_segments[column_id]);
+}
+
+void Chunk::replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment) {
+  DebugAssert(segment->size() == size(), "Replacement segment must have the same size");
+  std::atomic_store(&_segments[column_id], segment);
+}
+
+void Chunk::set_statistics(ColumnID column_id, std::shared_ptr<const SegmentStatistics> statistics) {
+  std::atomic_store(&_statistics[column_id], statistics);
+}
+
+std::shared_ptr<const SegmentStatistics> Chunk::get_statistics(ColumnID column_id) const {
+  return std::atomic_load(&_statistics[column_id]);
+}
 
 uint16_t Chunk::column_count() const { return _segments.size(); }
 
 uint32_t Chunk::size() const {
   if (_segments.size()) {
-    return _segments[0]->size();
+    return get_segment(ColumnID{0})->size();
   }
   return 0;
 }
 
+size_t Chunk::estimate_memory_usage() const {
+  std::unordered_set<const PosList*> counted_pos_lists;
+  return estimate_memory_usage(counted_pos_lists);
+}
+
+size_t Chunk::estimate_memory_usage(std::unordered_set<const PosList*>& counted_pos_lists) const {
+  auto bytes = sizeof(*this);
+  for (ColumnID column_id{0}; column_id < _segments.size(); ++column_id) {
+    const auto segment = get_segment(column_id);
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment);
+    if (reference_segment && !counted_pos_lists.insert(reference_segment->pos_list().get()).second) {
+      // The PosList was already counted for another segment, e.g., all columns of a TableScan output share one
+      bytes += sizeof(ReferenceSegment);
+    } else {
+      bytes += segment->estimate_memory_usage();
+    }
+  }
+  return bytes;
+}
+
 }  // namespace opossum
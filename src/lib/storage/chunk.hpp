@@ -6,6 +6,7 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "all_type_variant.hpp"
@@ -15,6 +16,7 @@ namespace opossum {
 
 class BaseIndex;
 class BaseSegment;
+struct SegmentStatistics;
 
 // A chunk is a horizontal partition of a table.
 // For each column in the table, it holds one segment. The segments across all chunks constitute the column.
@@ -38,6 +40,14 @@ class Chunk : private Noncopyable {
   // returns the number of rows (cannot exceed ChunkOffset (uint32_t))
   uint32_t size() const;
 
+  // returns an estimate of the number of bytes the segments of the chunk occupy. A PosList that several
+  // ReferenceSegments share is counted once.
+  size_t estimate_memory_usage() const;
+
+  // Like estimate_memory_usage(), but PosLists in counted_pos_lists are not counted, and the counted ones are added to
+  // it. Table::estimate_memory_usage() uses this to count PosLists that are shared across chunks once.
+  size_t estimate_memory_usage(std::unordered_set<const PosList*>& counted_pos_lists) const;
+
   // adds a new row, given as a list of values, to the chunk
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
@@ -45,9 +55,20 @@ class Chunk : private Noncopyable {
   // Returns the segment at a given position
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  // Atomically replaces the segment at a given position, e.g., by an encoded version of it. Concurrent readers that
+  // already obtained the old segment keep it alive until they are done.
+  void replace_segment(ColumnID column_id, std::shared_ptr<BaseSegment> segment);
+
+  // Sets the min/max statistics of the segment at a given position. This is done by Table::compress_chunk.
+  void set_statistics(ColumnID column_id, std::shared_ptr<const SegmentStatistics> statistics);
+
+  // Returns the min/max statistics of the segment at a given position, or nullptr if there are none
+  std::shared_ptr<const SegmentStatistics> get_statistics(ColumnID column_id) const;
+
  protected:
   // Implementation goes here
   std::vector<std::shared_ptr<BaseSegment>> _segments;
+  std::vector<std::shared_ptr<const SegmentStatistics>> _statistics;
 };
 
 }  // namespace opossum
@@ -0,0 +1,128 @@
+#include "chunk_compression_service.hpp"
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "value_segment.hpp"
+
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Chunks might already have been compressed, e.g., before the table was registered
+bool is_uncompressed(const Table& table, const Chunk& chunk) {
+  if (chunk.column_count() == 0) {
+    return false;
+  }
+
+  auto uncompressed = true;
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+    resolve_data_type(table.column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      uncompressed &= static_cast<bool>(std::dynamic_pointer_cast<ValueSegment<Type>>(chunk.get_segment(column_id)));
+    });
+  }
+  return uncompressed;
+}
+
+}  // namespace
+
+ChunkCompressionService::ChunkCompressionService(std::chrono::milliseconds poll_interval)
+    : _poll_interval(poll_interval) {}
+
+ChunkCompressionService::~ChunkCompressionService() { stop(); }
+
+void ChunkCompressionService::add_table(std::shared_ptr<Table> table, EncodingType encoding_type,
+                                        AttributeVectorType attribute_vector_type) {
+  if (encoding_type == EncodingType::FrameOfReference) {
+    // Fail here instead of in the background thread
+    for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+      resolve_data_type(table->column_type(column_id), [&](auto type) {
+        using Type = typename decltype(type)::type;
+        Assert(std::is_integral_v<Type>, "Frame-of-reference encoding is only supported for integer columns");
+      });
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(_tables_mutex);
+  _tables[std::move(table)] = TableCompressionConfig{encoding_type, attribute_vector_type};
+}
+
+void ChunkCompressionService::remove_table(const std::shared_ptr<Table>& table) {
+  std::lock_guard<std::mutex> lock(_tables_mutex);
+  Assert(_tables.erase(table) == 1, "Table is not registered");
+}
+
+void ChunkCompressionService::start() {
+  std::lock_guard<std::mutex> lock(_running_mutex);
+  Assert(!_running, "Compression service is already running");
+  _running = true;
+
+  _poll_thread = std::thread([this]() {
+    std::unique_lock<std::mutex> running_lock(_running_mutex);
+    while (_running) {
+      running_lock.unlock();
+      compress_full_chunks();
+      running_lock.lock();
+      _stop_condition.wait_for(running_lock, _poll_interval, [this]() { return !_running; });
+    }
+  });
+}
+
+void ChunkCompressionService::stop() {
+  {
+    std::lock_guard<std::mutex> lock(_running_mutex);
+    if (!_running) return;
+    _running = false;
+  }
+  _stop_condition.notify_all();
+  _poll_thread.join();
+}
+
+bool ChunkCompressionService::is_running() const {
+  std::lock_guard<std::mutex> lock(_running_mutex);
+  return _running;
+}
+
+size_t ChunkCompressionService::compress_full_chunks() {
+  std::lock_guard<std::mutex> lock(_tables_mutex);
+
+  struct CompressionJob {
+    std::shared_ptr<Table> table;
+    ChunkID chunk_id;
+    const TableCompressionConfig& config;
+  };
+
+  std::vector<CompressionJob> jobs;
+  for (auto& [table, config] : _tables) {
+    // Rows are only appended to the last chunk, so the chunks before it do not change anymore
+    const auto& const_table = static_cast<const Table&>(*table);
+    const auto last_chunk_id = ChunkID{const_table.chunk_count() - 1};
+    for (; config.next_chunk_id < last_chunk_id; ++config.next_chunk_id) {
+      const auto& chunk = const_table.get_chunk(config.next_chunk_id);
+      if (chunk.size() == const_table.chunk_size() && is_uncompressed(const_table, chunk)) {
+        jobs.push_back(CompressionJob{table, config.next_chunk_id, config});
+      }
+    }
+  }
+
+  std::vector<std::shared_ptr<AbstractTask>> compression_tasks;
+  for (size_t job_id = 0; job_id < jobs.size(); ++job_id) {
+    compression_tasks.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      const auto& job = jobs[job_id];
+      job.table->compress_chunk(job.chunk_id, job.config.encoding_type, job.config.attribute_vector_type);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(compression_tasks);
+
+  return jobs.size();
+}
+
+}  // namespace opossum
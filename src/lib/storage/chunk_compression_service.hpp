@@ -0,0 +1,64 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Compresses the chunks of registered tables in the background, so that nobody has to call Table::compress_chunk by
+// hand. A chunk is picked up once it has reached the table's chunk size and is no longer the last chunk of the table,
+// i.e., once no more rows are appended to it. Every chunk is compressed by a job of the CurrentScheduler, and the
+// encoded segments are swapped in by Table::compress_chunk without blocking concurrent scans.
+// Chunks of a registered table should not be compressed manually at the same time.
+class ChunkCompressionService : private Noncopyable {
+ public:
+  explicit ChunkCompressionService(std::chrono::milliseconds poll_interval = std::chrono::milliseconds{100});
+
+  // stops the background thread if it is still running
+  ~ChunkCompressionService();
+
+  // registers a table, whose chunks will be encoded with the given encoding
+  void add_table(std::shared_ptr<Table> table, EncodingType encoding_type = EncodingType::Dictionary,
+                 AttributeVectorType attribute_vector_type = AttributeVectorType::Fitted);
+
+  // unregisters a table; once this returns, none of its chunks is being compressed anymore
+  void remove_table(const std::shared_ptr<Table>& table);
+
+  // starts a background thread that calls compress_full_chunks() every poll interval
+  void start();
+
+  // stops the background thread and waits for the current compression pass to finish
+  void stop();
+
+  bool is_running() const;
+
+  // compresses all chunks that are ready and returns how many chunks were compressed
+  size_t compress_full_chunks();
+
+ protected:
+  struct TableCompressionConfig {
+    EncodingType encoding_type;
+    AttributeVectorType attribute_vector_type;
+    // all chunks before this one have either been compressed or cannot be compressed
+    ChunkID next_chunk_id{0};
+  };
+
+  const std::chrono::milliseconds _poll_interval;
+
+  // guards _tables and serializes the compression passes
+  std::mutex _tables_mutex;
+  std::map<std::shared_ptr<Table>, TableCompressionConfig> _tables;
+
+  mutable std::mutex _running_mutex;
+  std::condition_variable _stop_condition;
+  bool _running = false;
+  std::thread _poll_thread;
+};
+}  // namespace opossum
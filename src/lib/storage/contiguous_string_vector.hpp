@@ -0,0 +1,129 @@
+#pragma once
+
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// ContiguousStringVector is an immutable sequence of strings that stores all characters back to back in
+// a single buffer. An offsets array marks where each string begins. Compared to std::vector<std::string>, this needs
+// only two allocations in total, and iterating or binary-searching does not chase a pointer per string.
+//
+// Elements are accessed as std::string_view, which stays valid as long as the vector exists. The interface mirrors the
+// subset of std::vector that DictionarySegment uses, so that both can be used interchangeably as a dictionary.
+class ContiguousStringVector : private Noncopyable {
+ public:
+  // A random access iterator that yields std::string_views by value
+  class Iterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string_view;
+
+    Iterator(const ContiguousStringVector* vector, const size_t index) : _vector(vector), _index(index) {}
+
+    std::string_view operator*() const { return (*_vector)[_index]; }
+    std::string_view operator[](const difference_type distance) const { return (*_vector)[_index + distance]; }
+
+    Iterator& operator++() {
+      ++_index;
+      return *this;
+    }
+    Iterator operator++(int) { return Iterator{_vector, _index++}; }
+    Iterator& operator--() {
+      --_index;
+      return *this;
+    }
+    Iterator operator--(int) { return Iterator{_vector, _index--}; }
+    Iterator& operator+=(const difference_type distance) {
+      _index += distance;
+      return *this;
+    }
+    Iterator& operator-=(const difference_type distance) {
+      _index -= distance;
+      return *this;
+    }
+    Iterator operator+(const difference_type distance) const { return Iterator{_vector, _index + distance}; }
+    Iterator operator-(const difference_type distance) const { return Iterator{_vector, _index - distance}; }
+    difference_type operator-(const Iterator& other) const {
+      return static_cast<difference_type>(_index) - static_cast<difference_type>(other._index);
+    }
+
+    bool operator==(const Iterator& other) const { return _index == other._index; }
+    bool operator!=(const Iterator& other) const { return _index != other._index; }
+    bool operator<(const Iterator& other) const { return _index < other._index; }
+    bool operator<=(const Iterator& other) const { return _index <= other._index; }
+    bool operator>(const Iterator& other) const { return _index > other._index; }
+    bool operator>=(const Iterator& other) const { return _index >= other._index; }
+
+   protected:
+    const ContiguousStringVector* _vector;
+    size_t _index;
+  };
+
+  using value_type = std::string_view;
+  using const_iterator = Iterator;
+
+  // copies the strings (or string_views) in [begin, end) into the buffer
+  template <typename InputIterator>
+  ContiguousStringVector(InputIterator begin, InputIterator end) {
+    _offsets.reserve(std::distance(begin, end) + 1);
+    _offsets.push_back(0);
+
+    size_t total_length = 0;
+    for (auto it = begin; it != end; ++it) {
+      total_length += std::string_view{*it}.size();
+      _offsets.push_back(total_length);
+    }
+
+    _chars.reserve(total_length);
+    for (auto it = begin; it != end; ++it) {
+      const auto string = std::string_view{*it};
+      _chars.insert(_chars.end(), string.cbegin(), string.cend());
+    }
+  }
+
+  // we need to explicitly set the move constructor to default when
+  // we overwrite the copy constructor
+  ContiguousStringVector(ContiguousStringVector&&) = default;
+  ContiguousStringVector& operator=(ContiguousStringVector&&) = default;
+
+  // returns the string at a given position
+  std::string_view operator[](const size_t i) const {
+    return std::string_view{_chars.data() + _offsets[i], _offsets[i + 1] - _offsets[i]};
+  }
+
+  std::string_view front() const { return (*this)[0]; }
+  std::string_view back() const { return (*this)[size() - 1]; }
+
+  Iterator begin() const { return Iterator{this, 0}; }
+  Iterator end() const { return Iterator{this, size()}; }
+  Iterator cbegin() const { return begin(); }
+  Iterator cend() const { return end(); }
+
+  // returns the number of strings
+  size_t size() const { return _offsets.size() - 1; }
+
+  bool empty() const { return size() == 0; }
+
+  // returns the number of bytes used by the characters of all strings
+  size_t data_size() const { return _chars.size(); }
+
+  // returns an estimate of the number of bytes the vector occupies, including the character buffer and the offsets
+  size_t estimate_memory_usage() const {
+    return sizeof(*this) + _chars.capacity() + _offsets.capacity() * sizeof(size_t);
+  }
+
+ protected:
+  std::vector<char> _chars;
+  // string i occupies [_offsets[i], _offsets[i + 1]) in _chars
+  std::vector<size_t> _offsets;
+};
+
+}  // namespace opossum
@@ -4,6 +4,9 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -13,6 +16,8 @@
 #include "utils/performance_warning.hpp"
 
 #include "../lib/storage/base_attribute_vector.hpp"
+#include "../lib/storage/bit_packed_attribute_vector.hpp"
+#include "../lib/storage/contiguous_string_vector.hpp"
 #include "../lib/storage/fitted_attribute_vector.hpp"
 #include "../lib/storage/value_segment.hpp"
 #include "../lib/type_cast.hpp"
@@ -26,6 +31,11 @@ class BaseSegment;
 // types (uint8_t, uint16_t) since after a down-cast INVALID_VALUE_ID will look like their numeric_limit::max()
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
+// The container holding the sorted distinct values of a DictionarySegment. Strings are stored in one contiguous buffer
+// and accessed as std::string_view, all other types are kept in a std::vector.
+template <typename T>
+using DictionaryType = std::conditional_t<std::is_same_v<T, std::string>, ContiguousStringVector, std::vector<T>>;
+
 // Dictionary is a specific segment type that stores all its values in a vector
 template <typename T>
 class DictionarySegment : public BaseSegment {
@@ -33,22 +43,42 @@ class DictionarySegment : public BaseSegment {
   /**
    * Creates a Dictionary segment from a given value segment.
    */
-  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment) {
+  explicit DictionarySegment(const std::shared_ptr<BaseSegment>& base_segment,
+                             const AttributeVectorType attribute_vector_type = AttributeVectorType::Fitted) {
     const auto& values = std::static_pointer_cast<ValueSegment<T>>(base_segment)->values();
 
-    _dictionary = std::make_shared<std::vector<T>>(values.cbegin(), values.cend());
+    // Strings are handled as string_views into the value segment, so that no string is copied before it is written to
+    // the contiguous dictionary
+    using DistinctType = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+    // A hash-based distinct pass means that only the distinct values have to be sorted. The map is later reused to
+    // look up the ValueID of each row instead of binary searching the dictionary.
+    std::unordered_map<DistinctType, ValueID> value_ids;
+    for (const auto& value : values) {
+      value_ids.emplace(value, INVALID_VALUE_ID);
+    }
+
+    std::vector<DistinctType> distinct_values;
+    distinct_values.reserve(value_ids.size());
+    for (const auto& value_and_id : value_ids) {
+      distinct_values.push_back(value_and_id.first);
+    }
+    std::sort(distinct_values.begin(), distinct_values.end());
+
+    for (ValueID value_id{0}; value_id < distinct_values.size(); ++value_id) {
+      value_ids[distinct_values[value_id]] = value_id;
+    }
 
-    std::sort(_dictionary->begin(), _dictionary->end());
-    _dictionary->erase(std::unique(_dictionary->begin(), _dictionary->end()), _dictionary->end());
-    _dictionary->shrink_to_fit();
+    _dictionary = std::make_shared<DictionaryType<T>>(distinct_values.cbegin(), distinct_values.cend());
 
-    _attribute_vector = make_fitted_attribute_vector(_dictionary->size(), base_segment->size());
+    if (attribute_vector_type == AttributeVectorType::BitPacked) {
+      _attribute_vector = make_bit_packed_attribute_vector(_dictionary->size(), base_segment->size());
+    } else {
+      _attribute_vector = make_fitted_attribute_vector(_dictionary->size(), base_segment->size());
+    }
 
-    for (ValueID index{0}; index < base_segment->size(); index++) {
-      const auto it = std::lower_bound(_dictionary->cbegin(), _dictionary->cend(), values[index]);
-      DebugAssert(it != _dictionary->cend(), "Value must be contained in dictionary.");
-      ValueID position = static_cast<ValueID>(std::distance(_dictionary->cbegin(), it));
-      _attribute_vector->set(index, position);
+    for (size_t index = 0; index < values.size(); ++index) {
+      _attribute_vector->set(index, value_ids.find(DistinctType{values[index]})->second);
     }
   }
 
@@ -63,19 +93,20 @@ class DictionarySegment : public BaseSegment {
   }
 
   // return the value at a certain position.
-  const T get(const size_t i) const { return (*_dictionary)[_attribute_vector->get(i)]; }
+  const T get(const size_t i) const { return T{(*_dictionary)[_attribute_vector->get(i)]}; }
 
   // dictionary segments are immutable
   void append(const AllTypeVariant&) override { Fail("DictionarySegment is immutable."); }
 
   // returns an underlying dictionary
-  std::shared_ptr<const std::vector<T>> dictionary() const { return _dictionary; }
+  std::shared_ptr<const DictionaryType<T>> dictionary() const { return _dictionary; }
 
   // returns an underlying data structure
   std::shared_ptr<const BaseAttributeVector> attribute_vector() const { return _attribute_vector; }
 
   // return the value represented by a given ValueID
-  const T& value_by_value_id(ValueID value_id) const { return _dictionary[value_id]; }
+  // this is a const T& for all types but strings, which are returned as std::string_view into the dictionary
+  decltype(auto) value_by_value_id(ValueID value_id) const { return (*_dictionary)[value_id]; }
 
   // returns the first value ID that refers to a value >= the search value
   // returns INVALID_VALUE_ID if all values are smaller than the search value
@@ -109,8 +140,19 @@ class DictionarySegment : public BaseSegment {
   // return the number of entries
   size_t size() const override { return _attribute_vector->size(); }
 
+  // returns an estimate of the number of bytes the segment occupies, including its dictionary and attribute vector
+  size_t estimate_memory_usage() const override {
+    auto bytes = sizeof(*this) + _attribute_vector->estimate_memory_usage();
+    if constexpr (std::is_same_v<T, std::string>) {
+      bytes += _dictionary->estimate_memory_usage();
+    } else {
+      bytes += sizeof(*_dictionary) + _dictionary->capacity() * sizeof(T);
+    }
+    return bytes;
+  }
+
  protected:
-  std::shared_ptr<std::vector<T>> _dictionary;
+  std::shared_ptr<DictionaryType<T>> _dictionary;
   std::shared_ptr<BaseAttributeVector> _attribute_vector;
 };
 
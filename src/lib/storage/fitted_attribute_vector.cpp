@@ -1,11 +1,12 @@
 #include "fitted_attribute_vector.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "utils/assert.hpp"
 
-
 namespace opossum {
 
 template <typename T>
@@ -23,9 +24,27 @@ void FittedAttributeVector<T>::set(const size_t i, const ValueID value_id) {
 template <typename T>
 size_t FittedAttributeVector<T>::size() const { return _attribute_vector.size(); }
 
+template <typename T>
+size_t FittedAttributeVector<T>::estimate_memory_usage() const {
+  return sizeof(*this) + _attribute_vector.capacity() * sizeof(T);
+}
+
 template <typename T>
 AttributeVectorWidth FittedAttributeVector<T>::width() const { return AttributeVectorWidth{sizeof(T)}; }
 
+template <typename T>
+void FittedAttributeVector<T>::decode_into(const size_t start, std::vector<ValueID::base_type>& output) const {
+  DebugAssert(start + output.size() <= _attribute_vector.size(), "Cannot decode past the end of the attribute vector.");
+  std::copy_n(_attribute_vector.cbegin() + start, output.size(), output.begin());
+}
+
+template <typename T>
+const std::vector<T>& FittedAttributeVector<T>::values() const { return _attribute_vector; }
+
+template class FittedAttributeVector<uint8_t>;
+template class FittedAttributeVector<uint16_t>;
+template class FittedAttributeVector<uint32_t>;
+
 std::shared_ptr<BaseAttributeVector> make_fitted_attribute_vector(size_t dictionary_size, size_t segment_size) {
   Assert(dictionary_size <= std::numeric_limits<uint32_t>::max(), "Dictionary size is too large.");
   if (dictionary_size <= std::numeric_limits<uint8_t>::max()) {
@@ -23,9 +23,18 @@ class FittedAttributeVector : public BaseAttributeVector {
   // returns the number of values
   size_t size() const;
 
+  // returns an estimate of the number of bytes the attribute vector occupies
+  size_t estimate_memory_usage() const;
+
   // returns the width of biggest value id in bytes
   AttributeVectorWidth width() const;
 
+  // writes output.size() value ids starting at position start into output
+  void decode_into(const size_t start, std::vector<ValueID::base_type>& output) const;
+
+  // Returns all value ids. Prefer this over get() in loops, since it allows the compiler to inline and vectorize.
+  const std::vector<T>& values() const;
+
  protected:
   std::vector<T> _attribute_vector;
 };
@@ -0,0 +1,91 @@
+#include "frame_of_reference_segment.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+FrameOfReferenceSegment<T>::FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _block_minima(std::make_shared<std::vector<T>>()) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto& values = std::static_pointer_cast<ValueSegment<T>>(base_segment)->values();
+
+  // The first pass determines the minimum of each block and the largest offset, which defines the bit width
+  UnsignedT max_offset = 0;
+  for (size_t block_begin = 0; block_begin < values.size(); block_begin += BLOCK_SIZE) {
+    const auto block_end = values.cbegin() + std::min(block_begin + BLOCK_SIZE, values.size());
+    const auto [min, max] = std::minmax_element(values.cbegin() + block_begin, block_end);
+    _block_minima->push_back(*min);
+    const auto block_range = static_cast<UnsignedT>(static_cast<UnsignedT>(*max) - static_cast<UnsignedT>(*min));
+    max_offset = std::max(max_offset, block_range);
+  }
+
+  Assert(max_offset <= std::numeric_limits<uint32_t>::max(),
+         "Frame-of-reference encoding requires the value range of each block to fit into 32 bits.");
+  // The number of bits of the largest offset, as max_offset + 1 overflows 32 bits for the widest range
+  uint8_t bit_width = 1;
+  while (bit_width < 32 && (uint64_t{max_offset} >> bit_width) != 0) {
+    ++bit_width;
+  }
+  _offsets = std::make_shared<BitPackedAttributeVector>(bit_width, values.size());
+
+  for (size_t offset = 0; offset < values.size(); ++offset) {
+    const auto minimum = (*_block_minima)[offset / BLOCK_SIZE];
+    _offsets->set(offset, ValueID{static_cast<uint32_t>(static_cast<UnsignedT>(values[offset]) -
+                                                        static_cast<UnsignedT>(minimum))});
+  }
+}
+
+template <typename T>
+const AllTypeVariant FrameOfReferenceSegment<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+
+  return AllTypeVariant{get(i)};
+}
+
+template <typename T>
+const T FrameOfReferenceSegment<T>::get(const size_t i) const {
+  using UnsignedT = std::make_unsigned_t<T>;
+  const auto minimum = (*_block_minima)[i / BLOCK_SIZE];
+  return static_cast<T>(static_cast<UnsignedT>(minimum) + static_cast<UnsignedT>(_offsets->get(i)));
+}
+
+template <typename T>
+void FrameOfReferenceSegment<T>::append(const AllTypeVariant&) {
+  Fail("FrameOfReferenceSegment is immutable.");
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::size() const {
+  return _offsets->size();
+}
+
+template <typename T>
+size_t FrameOfReferenceSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(*_block_minima) + _block_minima->capacity() * sizeof(T) +
+         _offsets->estimate_memory_usage();
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> FrameOfReferenceSegment<T>::block_minima() const {
+  return _block_minima;
+}
+
+template <typename T>
+std::shared_ptr<const BitPackedAttributeVector> FrameOfReferenceSegment<T>::offsets() const {
+  return _offsets;
+}
+
+template class FrameOfReferenceSegment<int32_t>;
+template class FrameOfReferenceSegment<int64_t>;
+
+}  // namespace opossum
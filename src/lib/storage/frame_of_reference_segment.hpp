@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "bit_packed_attribute_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// FrameOfReferenceSegment is an immutable segment type for integer columns (int and long). The segment is divided into
+// blocks of BLOCK_SIZE rows. For each block, it stores the block's minimum, while each row only stores its offset to
+// that minimum, bit-packed with as many bits as the largest offset of the segment requires. This works well for
+// columns with many distinct values in a narrow range, such as timestamps or surrogate keys.
+//
+// The class is only instantiated for integral types. The offset of a value to its block minimum must fit into 32 bits.
+template <typename T>
+class FrameOfReferenceSegment : public BaseSegment {
+ public:
+  static constexpr ChunkOffset BLOCK_SIZE = 2048;
+
+  // creates a FrameOfReferenceSegment from a given value segment
+  explicit FrameOfReferenceSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position
+  const T get(const size_t i) const;
+
+  // frame-of-reference segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  // returns an estimate of the number of bytes the segment occupies
+  size_t estimate_memory_usage() const override;
+
+  // returns the minimum of each block
+  std::shared_ptr<const std::vector<T>> block_minima() const;
+
+  // returns the offset of each value to the minimum of its block
+  std::shared_ptr<const BitPackedAttributeVector> offsets() const;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _block_minima;
+  std::shared_ptr<BitPackedAttributeVector> _offsets;
+};
+
+}  // namespace opossum
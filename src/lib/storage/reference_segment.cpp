@@ -10,12 +10,19 @@ ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table> referenced
 const AllTypeVariant ReferenceSegment::operator[](const size_t i) const {
   PerformanceWarning("operator[] used");
   const auto row_id = (*_pos_list)[i];
+  if (row_id == NULL_ROW_ID) {
+    return NULL_VALUE;
+  }
 
   return (*_referenced_table->get_chunk(row_id.chunk_id).get_segment(_referenced_column_id))[row_id.chunk_offset];
 }
 
 size_t ReferenceSegment::size() const { return _pos_list->size(); }
 
+size_t ReferenceSegment::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(*_pos_list) + _pos_list->capacity() * sizeof(RowID);
+}
+
 const std::shared_ptr<const PosList> ReferenceSegment::pos_list() const { return _pos_list; }
 const std::shared_ptr<const Table> ReferenceSegment::referenced_table() const { return _referenced_table; }
 
@@ -17,6 +17,7 @@
 namespace opossum {
 
 // ReferenceSegment is a specific segment type that stores all its values as position list of a referenced segment
+// Positions with NULL_ROW_ID are NULL. ReferenceSegments never reference other ReferenceSegments.
 class ReferenceSegment : public BaseSegment {
  public:
   // creates a reference segment
@@ -30,6 +31,9 @@ class ReferenceSegment : public BaseSegment {
 
   size_t size() const override;
 
+  // returns an estimate of the number of bytes the segment occupies
+  size_t estimate_memory_usage() const override;
+
   const std::shared_ptr<const PosList> pos_list() const;
   const std::shared_ptr<const Table> referenced_table() const;
 
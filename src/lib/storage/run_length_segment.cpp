@@ -0,0 +1,80 @@
+#include "run_length_segment.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "utils/estimate_memory_usage.hpp"
+#include "utils/performance_warning.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+RunLengthSegment<T>::RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment)
+    : _values(std::make_shared<std::vector<T>>()), _end_positions(std::make_shared<std::vector<ChunkOffset>>()) {
+  const auto& values = std::static_pointer_cast<ValueSegment<T>>(base_segment)->values();
+
+  for (ChunkOffset offset = 0; offset < values.size(); ++offset) {
+    if (_values->empty() || values[offset] != _values->back()) {
+      _values->push_back(values[offset]);
+      _end_positions->push_back(offset);
+    } else {
+      _end_positions->back() = offset;
+    }
+  }
+
+  _values->shrink_to_fit();
+  _end_positions->shrink_to_fit();
+}
+
+template <typename T>
+const AllTypeVariant RunLengthSegment<T>::operator[](const size_t i) const {
+  PerformanceWarning("operator[] used");
+
+  return AllTypeVariant{get(i)};
+}
+
+template <typename T>
+const T RunLengthSegment<T>::get(const size_t i) const {
+  DebugAssert(i < size(), "Offset out of range");
+  const auto run = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), i);
+  return (*_values)[std::distance(_end_positions->cbegin(), run)];
+}
+
+template <typename T>
+void RunLengthSegment<T>::append(const AllTypeVariant&) {
+  Fail("RunLengthSegment is immutable.");
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::size() const {
+  return _end_positions->empty() ? 0 : _end_positions->back() + 1;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + sizeof(*_values) + estimate_vector_memory_usage(*_values) + sizeof(*_end_positions) +
+         _end_positions->capacity() * sizeof(ChunkOffset);
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<T>> RunLengthSegment<T>::values() const {
+  return _values;
+}
+
+template <typename T>
+std::shared_ptr<const std::vector<ChunkOffset>> RunLengthSegment<T>::end_positions() const {
+  return _end_positions;
+}
+
+template <typename T>
+size_t RunLengthSegment<T>::run_count() const {
+  return _values->size();
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(RunLengthSegment);
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// RunLengthSegment is an immutable segment type that stores consecutive equal values only once. For each run, it keeps
+// the value and the offset of the run's last row. Sorted or clustered columns thus need only as much space as they
+// have runs, and predicates can be evaluated once per run instead of once per row.
+template <typename T>
+class RunLengthSegment : public BaseSegment {
+ public:
+  // creates a RunLengthSegment from a given value segment
+  explicit RunLengthSegment(const std::shared_ptr<BaseSegment>& base_segment);
+
+  // return the value at a certain position. If you want to write efficient operators, back off!
+  const AllTypeVariant operator[](const size_t i) const override;
+
+  // return the value at a certain position. This requires a binary search over the runs.
+  const T get(const size_t i) const;
+
+  // run-length segments are immutable
+  void append(const AllTypeVariant&) override;
+
+  // return the number of entries
+  size_t size() const override;
+
+  // returns an estimate of the number of bytes the segment occupies
+  size_t estimate_memory_usage() const override;
+
+  // returns the value of each run
+  std::shared_ptr<const std::vector<T>> values() const;
+
+  // returns the (inclusive) offset of the last row of each run
+  std::shared_ptr<const std::vector<ChunkOffset>> end_positions() const;
+
+  // return the number of runs
+  size_t run_count() const;
+
+ protected:
+  std::shared_ptr<std::vector<T>> _values;
+  std::shared_ptr<std::vector<ChunkOffset>> _end_positions;
+};
+
+}  // namespace opossum
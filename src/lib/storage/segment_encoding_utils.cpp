@@ -0,0 +1,67 @@
+#include "segment_encoding_utils.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include "dictionary_segment.hpp"
+#include "frame_of_reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "run_length_segment.hpp"
+#include "segment_statistics.hpp"
+#include "value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<BaseSegment> encode_segment(const EncodingType encoding_type, const std::string& data_type,
+                                            const std::shared_ptr<BaseSegment>& segment,
+                                            const AttributeVectorType attribute_vector_type) {
+  switch (encoding_type) {
+    case EncodingType::Dictionary:
+      return make_shared_by_data_type<BaseSegment, DictionarySegment>(data_type, segment, attribute_vector_type);
+    case EncodingType::RunLength:
+      return make_shared_by_data_type<BaseSegment, RunLengthSegment>(data_type, segment);
+    case EncodingType::FrameOfReference: {
+      std::shared_ptr<BaseSegment> encoded_segment;
+      resolve_data_type(data_type, [&](auto type) {
+        using Type = typename decltype(type)::type;
+        if constexpr (std::is_integral_v<Type>) {
+          encoded_segment = std::make_shared<FrameOfReferenceSegment<Type>>(segment);
+        } else {
+          Fail("Frame-of-reference encoding is only supported for integer columns");
+        }
+      });
+      return encoded_segment;
+    }
+    default:
+      Fail("Unrecognized EncodingType");
+      return nullptr;
+  }
+}
+
+std::shared_ptr<const SegmentStatistics> compute_segment_statistics(
+    const std::string& data_type, const std::shared_ptr<BaseSegment>& value_segment,
+    const std::shared_ptr<BaseSegment>& encoded_segment) {
+  if (value_segment->size() == 0) return nullptr;
+
+  std::shared_ptr<const SegmentStatistics> statistics;
+  resolve_data_type(data_type, [&](auto type) {
+    using Type = typename decltype(type)::type;
+
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<Type>>(encoded_segment)) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      statistics = std::make_shared<SegmentStatistics>(
+          SegmentStatistics{AllTypeVariant{Type{dictionary.front()}}, AllTypeVariant{Type{dictionary.back()}}});
+      return;
+    }
+
+    const auto& values = std::static_pointer_cast<ValueSegment<Type>>(value_segment)->values();
+    const auto [min, max] = std::minmax_element(values.cbegin(), values.cend());
+    statistics = std::make_shared<SegmentStatistics>(SegmentStatistics{AllTypeVariant{*min}, AllTypeVariant{*max}});
+  });
+  return statistics;
+}
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+struct SegmentStatistics;
+
+// Encodes a ValueSegment of the given data type with the requested encoding. The attribute vector type is only
+// relevant for dictionary encoding.
+std::shared_ptr<BaseSegment> encode_segment(const EncodingType encoding_type, const std::string& data_type,
+                                            const std::shared_ptr<BaseSegment>& segment,
+                                            const AttributeVectorType attribute_vector_type);
+
+// Computes the min/max statistics of an encoded segment. Dictionary segments provide them for free through their
+// sorted dictionary, for all other encodings they are taken from the original value segment.
+// Returns nullptr for empty segments.
+std::shared_ptr<const SegmentStatistics> compute_segment_statistics(
+    const std::string& data_type, const std::shared_ptr<BaseSegment>& value_segment,
+    const std::shared_ptr<BaseSegment>& encoded_segment);
+
+}  // namespace opossum
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/bit_packed_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// The type in which segment_iterate passes the values of a segment of data type T. Strings are passed as
+// std::string_view into the segment, so that they are never copied.
+template <typename T>
+using SegmentValueType = std::conditional_t<std::is_same_v<T, std::string>, std::string_view, T>;
+
+// A single position of a segment as passed by segment_iterate
+template <typename T>
+class SegmentPosition {
+ public:
+  SegmentPosition(const SegmentValueType<T> value, const ChunkOffset chunk_offset, const bool is_null = false)
+      : _value(value), _chunk_offset(chunk_offset), _is_null(is_null) {}
+
+  // returns the value at this position, which is default-constructed if the position is NULL
+  const SegmentValueType<T>& value() const { return _value; }
+
+  // returns whether the position is NULL, which is only possible for positions of ReferenceSegments with NULL_ROW_ID
+  bool is_null() const { return _is_null; }
+
+  // returns the offset of this position within the iterated segment. For ReferenceSegments, this is the offset within
+  // the ReferenceSegment, i.e., the index into its PosList, and not the offset within the referenced segment.
+  ChunkOffset chunk_offset() const { return _chunk_offset; }
+
+ protected:
+  SegmentValueType<T> _value;
+  ChunkOffset _chunk_offset;
+  bool _is_null;
+};
+
+// number of ValueIDs or offsets that are unpacked at once when iterating over a bit-packed vector
+constexpr size_t SEGMENT_ITERATE_BLOCK_SIZE = 1024;
+
+namespace detail {
+
+// Calls func for the positions [begin, end) of a PosList, which all have to refer to the same chunk and thus to the
+// same segment. The loop is instantiated for the encoding of that segment, so the values are gathered without
+// resolving the segment again for every position. Positions are passed with their index into the PosList.
+template <typename T, typename SegmentType, typename Functor>
+void segment_gather(const SegmentType& segment, const PosList& pos_list, const ChunkOffset begin,
+                    const ChunkOffset end, const Functor& func) {
+  if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+    const auto& values = segment.values();
+    for (auto index = begin; index < end; ++index) {
+      func(SegmentPosition<T>{values[pos_list[index].chunk_offset], index});
+    }
+  } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+    const auto& dictionary = *segment.dictionary();
+    resolve_attribute_vector(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+      using VectorType = std::decay_t<decltype(attribute_vector)>;
+      if constexpr (std::is_same_v<VectorType, BitPackedAttributeVector>) {
+        for (auto index = begin; index < end; ++index) {
+          func(SegmentPosition<T>{dictionary[attribute_vector.get(pos_list[index].chunk_offset)], index});
+        }
+      } else {
+        const auto& value_ids = attribute_vector.values();
+        for (auto index = begin; index < end; ++index) {
+          func(SegmentPosition<T>{dictionary[value_ids[pos_list[index].chunk_offset]], index});
+        }
+      }
+    });
+  } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+    // RunLengthSegment::get() returns a copy, which would leave a string_view dangling
+    const auto& values = *segment.values();
+    const auto& end_positions = *segment.end_positions();
+    for (auto index = begin; index < end; ++index) {
+      const auto run = std::lower_bound(end_positions.cbegin(), end_positions.cend(), pos_list[index].chunk_offset);
+      func(SegmentPosition<T>{values[std::distance(end_positions.cbegin(), run)], index});
+    }
+  } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
+    for (auto index = begin; index < end; ++index) {
+      func(SegmentPosition<T>{segment.get(pos_list[index].chunk_offset), index});
+    }
+  } else {
+    Fail("ReferenceSegments cannot reference other ReferenceSegments");
+  }
+}
+
+// Calls func for every position of a segment that is not a ReferenceSegment, using the loop that fits its encoding best
+template <typename T, typename SegmentType, typename Functor>
+void segment_iterate_encoded(const SegmentType& segment, const Functor& func) {
+  if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+    const auto& values = segment.values();
+    for (ChunkOffset chunk_offset = 0; chunk_offset < values.size(); ++chunk_offset) {
+      func(SegmentPosition<T>{values[chunk_offset], chunk_offset});
+    }
+  } else if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) {
+    const auto& dictionary = *segment.dictionary();
+    resolve_attribute_vector(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+      using VectorType = std::decay_t<decltype(attribute_vector)>;
+      if constexpr (std::is_same_v<VectorType, BitPackedAttributeVector>) {
+        std::vector<ValueID::base_type> block(SEGMENT_ITERATE_BLOCK_SIZE);
+        for (ChunkOffset block_begin = 0; block_begin < attribute_vector.size(); block_begin += block.size()) {
+          block.resize(std::min(block.size(), attribute_vector.size() - block_begin));
+          attribute_vector.decode_into(block_begin, block);
+          for (ChunkOffset index = 0; index < block.size(); ++index) {
+            func(SegmentPosition<T>{dictionary[block[index]], block_begin + index});
+          }
+        }
+      } else {
+        const auto& value_ids = attribute_vector.values();
+        for (ChunkOffset chunk_offset = 0; chunk_offset < value_ids.size(); ++chunk_offset) {
+          func(SegmentPosition<T>{dictionary[value_ids[chunk_offset]], chunk_offset});
+        }
+      }
+    });
+  } else if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) {
+    const auto& values = *segment.values();
+    const auto& end_positions = *segment.end_positions();
+    ChunkOffset chunk_offset = 0;
+    for (size_t run = 0; run < values.size(); ++run) {
+      const SegmentValueType<T> value = values[run];
+      for (; chunk_offset <= end_positions[run]; ++chunk_offset) {
+        func(SegmentPosition<T>{value, chunk_offset});
+      }
+    }
+  } else if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    const auto& block_minima = *segment.block_minima();
+    const auto& offsets = *segment.offsets();
+    std::vector<ValueID::base_type> block;
+    for (size_t block_index = 0; block_index < block_minima.size(); ++block_index) {
+      const auto block_begin = static_cast<ChunkOffset>(block_index * FrameOfReferenceSegment<T>::BLOCK_SIZE);
+      block.resize(std::min(size_t{FrameOfReferenceSegment<T>::BLOCK_SIZE}, segment.size() - block_begin));
+      offsets.decode_into(block_begin, block);
+      const auto minimum = static_cast<UnsignedT>(block_minima[block_index]);
+      for (ChunkOffset index = 0; index < block.size(); ++index) {
+        func(SegmentPosition<T>{static_cast<T>(minimum + static_cast<UnsignedT>(block[index])), block_begin + index});
+      }
+    }
+  } else {
+    Fail("ReferenceSegments cannot reference other ReferenceSegments");
+  }
+}
+
+}  // namespace detail
+
+/**
+ * Calls func for every position of a segment of data type T, in the order of the segment. The loop over the positions
+ * is instantiated separately for each encoding, so that func is inlined into a typed loop instead of being called
+ * with an AllTypeVariant. For ReferenceSegments, the referenced values are passed in the order of the PosList. The
+ * referenced segments are resolved once per run of positions in the same chunk, so iterating over the output of a
+ * TableScan costs about as much as iterating over its input.
+ *
+ * @param segment is any segment of the data type T
+ * @param func is a generic lambda or similar accepting a const SegmentPosition<T>&
+ *
+ *
+ * Example:
+ *
+ *   segment_iterate<T>(*chunk.get_segment(column_id), [&](const auto& position) {
+ *     if (position.value() > search_value) pos_list.emplace_back(RowID{chunk_id, position.chunk_offset()});
+ *   });
+ */
+template <typename T, typename Functor>
+void segment_iterate(const BaseSegment& segment, const Functor& func) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      const auto& pos_list = *typed_segment.pos_list();
+      const auto& referenced_table = *typed_segment.referenced_table();
+      const auto referenced_column_id = typed_segment.referenced_column_id();
+
+      // Consecutive positions that refer to the same chunk form a run. The referenced segment is fetched and resolved
+      // only once per run, which avoids taking the table's chunk lock and casting the segment for every position.
+      ChunkOffset run_begin = 0;
+      while (run_begin < pos_list.size()) {
+        const auto chunk_id = pos_list[run_begin].chunk_id;
+        auto run_end = run_begin + 1;
+        while (run_end < pos_list.size() && pos_list[run_end].chunk_id == chunk_id) {
+          ++run_end;
+        }
+
+        if (chunk_id == INVALID_CHUNK_ID) {
+          // a run of NULL_ROW_IDs
+          for (auto index = run_begin; index < run_end; ++index) {
+            func(SegmentPosition<T>{SegmentValueType<T>{}, index, true});
+          }
+          run_begin = run_end;
+          continue;
+        }
+
+        const auto referenced_segment = referenced_table.get_chunk(chunk_id).get_segment(referenced_column_id);
+        resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_referenced_segment) {
+          detail::segment_gather<T>(typed_referenced_segment, pos_list, run_begin, run_end, func);
+        });
+        run_begin = run_end;
+      }
+    } else {
+      detail::segment_iterate_encoded<T>(typed_segment, func);
+    }
+  });
+}
+
+// Calls func for the given offsets of a segment of data type T, in the order of chunk_offsets. Unlike in
+// segment_iterate, the chunk_offset() of a position is its index into chunk_offsets. This reads only the requested
+// positions, e.g., the few rows that are left after a filter on another column, instead of the whole segment.
+template <typename T, typename Functor>
+void segment_iterate_offsets(const BaseSegment& segment, const std::vector<ChunkOffset>& chunk_offsets,
+                             const Functor& func) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      // The positions are looked up in the PosList and iterated like a ReferenceSegment with only these positions
+      const auto& pos_list = *typed_segment.pos_list();
+      auto selected_pos_list = std::make_shared<PosList>(chunk_offsets.size());
+      for (size_t index = 0; index < chunk_offsets.size(); ++index) {
+        (*selected_pos_list)[index] = pos_list[chunk_offsets[index]];
+      }
+      const auto selected_segment = ReferenceSegment{typed_segment.referenced_table(),
+                                                     typed_segment.referenced_column_id(), selected_pos_list};
+      segment_iterate<T>(selected_segment, func);
+    } else {
+      PosList pos_list(chunk_offsets.size());
+      for (size_t index = 0; index < chunk_offsets.size(); ++index) {
+        pos_list[index] = RowID{ChunkID{0}, chunk_offsets[index]};
+      }
+      detail::segment_gather<T>(typed_segment, pos_list, 0, static_cast<ChunkOffset>(pos_list.size()), func);
+    }
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "all_type_variant.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Minimum and maximum of an immutable segment, also known as a zone map. They are computed when a chunk is compressed
+// and allow operators to skip chunks that cannot contain any value fulfilling a predicate.
+struct SegmentStatistics {
+  AllTypeVariant min;
+  AllTypeVariant max;
+};
+
+// returns true if no value in the range [statistics.min, statistics.max] can fulfill "value <scan_type> search_value"
+template <typename T>
+bool can_prune(const SegmentStatistics& statistics, const ScanType scan_type, const T& search_value) {
+  const auto min = type_cast<T>(statistics.min);
+  const auto max = type_cast<T>(statistics.max);
+
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return search_value < min || search_value > max;
+    case ScanType::OpNotEquals:
+      return min == max && min == search_value;
+    case ScanType::OpLessThan:
+      return min >= search_value;
+    case ScanType::OpLessThanEquals:
+      return min > search_value;
+    case ScanType::OpGreaterThan:
+      return max <= search_value;
+    case ScanType::OpGreaterThanEquals:
+      return max < search_value;
+    default:
+      Fail("Unrecognized ScanType");
+      return false;
+  }
+}
+
+}  // namespace opossum
@@ -6,13 +6,17 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
-#include "dictionary_segment.hpp"
+#include "segment_encoding_utils.hpp"
+#include "segment_statistics.hpp"
 #include "value_segment.hpp"
 
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -30,23 +34,73 @@ void Table::add_column_definition(const std::string& name, const std::string& ty
 
 void Table::add_column(const std::string& name, const std::string& type) {
   add_column_definition(name, type);
-  _chunks.back().add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
+  _last_chunk().add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
-  if (_chunks.back().size() == _chunk_size) {
+  if (_last_chunk().size() == _chunk_size) {
     _add_chunk();
   }
-  _chunks.back().append(values);
+  _last_chunk().append(values);
 }
 
-void Table::create_new_chunk() {
-  // Implementation goes here
+void Table::_append_value_segments(const std::vector<std::shared_ptr<BaseSegment>>& columns) {
+  Assert(columns.size() == column_count(), "Column count does not match the table");
+  Assert(_chunk_size > 0, "Cannot split rows into chunks of size 0");
+
+  const auto row_count = columns.empty() ? size_t{0} : columns.front()->size();
+  for (ColumnID column_id{0}; column_id < columns.size(); ++column_id) {
+    Assert(columns[column_id]->size() == row_count, "All columns must have the same number of rows");
+    resolve_data_type(column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      Assert(std::dynamic_pointer_cast<ValueSegment<Type>>(columns[column_id]),
+             "Column " + column_name(column_id) + " must be given as values of type " + column_type(column_id));
+    });
+  }
+
+  size_t offset = 0;
+  while (offset < row_count) {
+    if (_last_chunk().size() == _chunk_size) {
+      _add_chunk();
+    }
+
+    auto& chunk = _last_chunk();
+    const auto rows_to_append = std::min(size_t{_chunk_size - chunk.size()}, row_count - offset);
+
+    if (chunk.size() == 0 && rows_to_append == row_count) {
+      // All rows fit into the empty last chunk, so it can take over the segments, which only the table holds
+      Chunk new_chunk;
+      for (const auto& column : columns) {
+        new_chunk.add_segment(column);
+      }
+      chunk = std::move(new_chunk);
+    } else {
+      // The initial chunk has no segments yet if only column definitions were added
+      if (chunk.column_count() == 0) {
+        for (const auto& type : _column_types) {
+          chunk.add_segment(make_shared_by_data_type<BaseSegment, ValueSegment>(type));
+        }
+      }
+      for (ColumnID column_id{0}; column_id < columns.size(); ++column_id) {
+        resolve_data_type(column_type(column_id), [&](auto type) {
+          using Type = typename decltype(type)::type;
+          const auto& values = std::static_pointer_cast<ValueSegment<Type>>(columns[column_id])->values();
+          const auto value_segment = std::static_pointer_cast<ValueSegment<Type>>(chunk.get_segment(column_id));
+          value_segment->append_values(values.cbegin() + offset, values.cbegin() + offset + rows_to_append);
+        });
+      }
+    }
+
+    offset += rows_to_append;
+  }
 }
 
+void Table::create_new_chunk() { _add_chunk(); }
+
 uint16_t Table::column_count() const { return _column_types.size(); }
 
 uint64_t Table::row_count() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex_chunk_access);
   uint64_t count = 0;
   for (const auto& chunk : _chunks) {
     count += chunk.size();
@@ -54,7 +108,20 @@ uint64_t Table::row_count() const {
   return count;
 }
 
-ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunks.size()); }
+ChunkID Table::chunk_count() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex_chunk_access);
+  return static_cast<ChunkID>(_chunks.size());
+}
+
+size_t Table::estimate_memory_usage() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex_chunk_access);
+  auto bytes = sizeof(*this);
+  std::unordered_set<const PosList*> counted_pos_lists;
+  for (const auto& chunk : _chunks) {
+    bytes += chunk.estimate_memory_usage(counted_pos_lists);
+  }
+  return bytes;
+}
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   auto const pos = std::find(_column_names.begin(), _column_names.end(), column_name);
@@ -83,6 +150,11 @@ const Chunk& Table::get_chunk(ChunkID chunk_id) const {
   return _chunks[chunk_id];
 }
 
+Chunk& Table::_last_chunk() {
+  std::shared_lock<std::shared_mutex> lock(_mutex_chunk_access);
+  return _chunks.back();
+}
+
 void Table::_add_chunk() {
   Chunk new_chunk;
   for (auto const& type : _column_types) {
@@ -91,25 +163,71 @@ void Table::_add_chunk() {
   emplace_chunk(new_chunk);
 }
 
-void Table::compress_chunk(ChunkID chunk_id) {
-  Assert(chunk_id < _chunks.size(), "Chunk ID out of range");
+void Table::compress_chunk(ChunkID chunk_id, EncodingType encoding_type, AttributeVectorType attribute_vector_type) {
+  std::vector<std::shared_ptr<BaseSegment>> segments;
+  {
+    std::shared_lock<std::shared_mutex> lock(_mutex_chunk_access);
+    Assert(chunk_id < _chunks.size(), "Chunk ID out of range");
 
-  Chunk new_chunk;
+    const auto& old_chunk = _chunks[chunk_id];
+    Assert(old_chunk.size() == _chunk_size, "Chunk not full");
 
-  const auto& old_chunk = get_chunk(chunk_id);
+    for (ColumnID column_id = ColumnID{0}; column_id < old_chunk.column_count(); ++column_id) {
+      segments.push_back(old_chunk.get_segment(column_id));
+    }
+  }
 
-  Assert(old_chunk.size() == _chunk_size, "Chunk not full");
+  // The encoding, which is the expensive part, does not hold the lock. Each column is encoded by its own job.
+  std::vector<std::shared_ptr<BaseSegment>> encoded_segments(segments.size());
+  std::vector<std::shared_ptr<const SegmentStatistics>> statistics(segments.size());
+  for (ColumnID column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+    resolve_data_type(column_type(column_id), [&](auto type) {
+      using Type = typename decltype(type)::type;
+      Assert(std::dynamic_pointer_cast<ValueSegment<Type>>(segments[column_id]), "Chunk is already compressed");
+    });
+  }
 
-  for (ColumnID column_id = ColumnID{0}; column_id < old_chunk.column_count(); ++column_id) {
-    const auto segment = old_chunk.get_segment(column_id);
+  const auto encode_column = [&](const ColumnID column_id) {
+    encoded_segments[column_id] =
+        encode_segment(encoding_type, column_type(column_id), segments[column_id], attribute_vector_type);
+    statistics[column_id] =
+        compute_segment_statistics(column_type(column_id), segments[column_id], encoded_segments[column_id]);
+  };
 
-    new_chunk.add_segment(make_shared_by_data_type<BaseSegment, DictionarySegment>(column_type(column_id), segment));
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (ColumnID column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() { encode_column(column_id); }));
   }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
 
-  std::unique_lock<std::shared_mutex> lock(_mutex_chunk_access);
-  _chunks[chunk_id] = std::move(new_chunk);
+  // Each segment is swapped in atomically. As the encoded segments hold the same values, concurrent scans see the same
+  // data no matter whether they read a segment before or after its replacement. A shared lock suffices because the
+  // chunk vector itself is not modified.
+  std::shared_lock<std::shared_mutex> lock(_mutex_chunk_access);
+  auto& chunk = _chunks[chunk_id];
+  for (ColumnID column_id = ColumnID{0}; column_id < encoded_segments.size(); ++column_id) {
+    chunk.set_statistics(column_id, statistics[column_id]);
+    chunk.replace_segment(column_id, encoded_segments[column_id]);
+  }
 }
 
-void Table::emplace_chunk(Chunk& chunk) { _chunks.emplace_back(std::move(chunk)); }
+void Table::compress_chunks(const std::vector<ChunkID>& chunk_ids, EncodingType encoding_type,
+                            AttributeVectorType attribute_vector_type) {
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (const auto& chunk_id : chunk_ids) {
+    jobs.emplace_back(std::make_shared<JobTask>(
+        [&, chunk_id]() { compress_chunk(chunk_id, encoding_type, attribute_vector_type); }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
+void Table::emplace_chunk(Chunk& chunk) {
+  std::unique_lock<std::shared_mutex> lock(_mutex_chunk_access);
+  if (_chunks.size() == 1 && _chunks.back().column_count() == 0) {
+    _chunks.back() = std::move(chunk);
+  } else {
+    _chunks.emplace_back(std::move(chunk));
+  }
+}
 
 }  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <shared_mutex>
 
+#include <deque>
 #include <limits>
 #include <map>
 #include <memory>
@@ -12,6 +13,7 @@
 
 #include "base_segment.hpp"
 #include "chunk.hpp"
+#include "value_segment.hpp"
 
 #include "type_cast.hpp"
 #include "types.hpp"
@@ -45,11 +47,16 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
+  // returns an estimate of the number of bytes the chunks of the table occupy, counting every PosList of its
+  // ReferenceSegments once
+  size_t estimate_memory_usage() const;
+
   // returns the chunk with the given id
   Chunk& get_chunk(ChunkID chunk_id);
   const Chunk& get_chunk(ChunkID chunk_id) const;
 
-  // Adds a chunk to the table. If the first chunk is empty, it is replaced.
+  // Adds a chunk to the table. If the table only has its initial chunk and that chunk has no segments, e.g., because
+  // only column definitions were added, it is replaced.
   void emplace_chunk(Chunk& chunk);
 
   // Returns a list of all column names.
@@ -83,20 +90,43 @@ class Table : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(std::vector<AllTypeVariant> values);
 
+  // Inserts many rows at the end of the table, given column by column as vectors of the columns' types, e.g.,
+  // append_columns(std::move(int_values), std::move(string_values)). The rows are split at chunk_size() boundaries: the
+  // last chunk is filled up first, further chunks are created for the remaining rows. If all rows fit into a new,
+  // empty chunk, the vectors are moved into its segments without copying any value.
+  // Like append(), this is not thread-safe.
+  template <typename... Types>
+  void append_columns(std::vector<Types>&&... columns) {
+    _append_value_segments({std::make_shared<ValueSegment<Types>>(std::move(columns))...});
+  }
+
   // creates a new chunk and appends it
   void create_new_chunk();
 
-  // compresses a ValueSegment into a DictionarySegment
-  void compress_chunk(ChunkID chunk_id);
+  // compresses the ValueSegments of a full chunk, by default into DictionarySegments, and computes min/max statistics
+  // the attribute vector type decides how the ValueIDs of the dictionary segments are stored
+  // the columns are encoded by parallel jobs; concurrent scans are not blocked while encoded segments are swapped in
+  void compress_chunk(ChunkID chunk_id, EncodingType encoding_type = EncodingType::Dictionary,
+                      AttributeVectorType attribute_vector_type = AttributeVectorType::Fitted);
+
+  // compresses several full chunks in parallel jobs, using the same encoding for all of them
+  void compress_chunks(const std::vector<ChunkID>& chunk_ids, EncodingType encoding_type = EncodingType::Dictionary,
+                       AttributeVectorType attribute_vector_type = AttributeVectorType::Fitted);
 
  protected:
   uint32_t _chunk_size;
-  std::vector<Chunk> _chunks;
+  // A deque keeps the chunks at their addresses when chunks are added, so that the references returned by get_chunk()
+  // stay valid while another thread, e.g., the one appending rows, adds chunks
+  std::deque<Chunk> _chunks;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
 
  private:
   void _add_chunk();
+  // appends the rows of ValueSegments that are owned by the table, see append_columns()
+  void _append_value_segments(const std::vector<std::shared_ptr<BaseSegment>>& columns);
+  // returns the chunk to which rows are appended
+  Chunk& _last_chunk();
   mutable std::shared_mutex _mutex_chunk_access;
 };
 }  // namespace opossum
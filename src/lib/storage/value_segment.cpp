@@ -9,10 +9,14 @@
 
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
+#include "utils/estimate_memory_usage.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
 
+template <typename T>
+ValueSegment<T>::ValueSegment(std::vector<T>&& values) : _values(std::move(values)) {}
+
 template <typename T>
 const AllTypeVariant ValueSegment<T>::operator[](const size_t offset) const {
   PerformanceWarning("operator[] used");
@@ -25,11 +29,22 @@ void ValueSegment<T>::append(const AllTypeVariant& val) {
   _values.push_back(type_cast<T>(val));
 }
 
+template <typename T>
+void ValueSegment<T>::append_values(typename std::vector<T>::const_iterator begin,
+                                    typename std::vector<T>::const_iterator end) {
+  _values.insert(_values.end(), begin, end);
+}
+
 template <typename T>
 size_t ValueSegment<T>::size() const {
   return _values.size();
 }
 
+template <typename T>
+size_t ValueSegment<T>::estimate_memory_usage() const {
+  return sizeof(*this) + estimate_vector_memory_usage(_values);
+}
+
 template <typename T>
 const std::vector<T>& ValueSegment<T>::values() const {
   return _values;
@@ -13,15 +13,26 @@ namespace opossum {
 template <typename T>
 class ValueSegment : public BaseSegment {
  public:
+  ValueSegment() = default;
+
+  // creates a segment that takes ownership of the given values
+  explicit ValueSegment(std::vector<T>&& values);
+
   // return the value at a certain position. If you want to write efficient operators, back off!
   const AllTypeVariant operator[](const size_t offset) const override;
 
   // add a value to the end
   void append(const AllTypeVariant& val) override;
 
+  // add a range of typed values to the end, without converting each of them from an AllTypeVariant
+  void append_values(typename std::vector<T>::const_iterator begin, typename std::vector<T>::const_iterator end);
+
   // return the number of entries
   size_t size() const override;
 
+  // returns an estimate of the number of bytes the segment occupies
+  size_t estimate_memory_usage() const override;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
@@ -10,6 +10,7 @@
 #include <string>
 
 #include "all_type_variant.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -34,11 +35,14 @@ const T& get(const AllTypeVariant& value) {
 }
 
 // cast methods - from variant to specific type
+// NULL cannot be cast to any type, not even to std::string, for which lexical_cast would return "NULL". The index of a
+// type in AllTypeVariant is its index in types plus one, because NullValue is the first type of the variant.
 
 // Template specialization for everything but integral types
 template <typename T>
 std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+  Assert(!variant_is_null(value), "Cannot cast NULL");
+  if (value.which() == detail::index_of(types, hana::type_c<T>) + 1) return get<T>(value);
 
   return boost::lexical_cast<T>(value);
 }
@@ -46,7 +50,8 @@ std::enable_if_t<!std::is_integral<T>::value, T> type_cast(const AllTypeVariant&
 // Template specialization for integral types
 template <typename T>
 std::enable_if_t<std::is_integral<T>::value, T> type_cast(const AllTypeVariant& value) {
-  if (value.which() == detail::index_of(types, hana::type_c<T>)) return get<T>(value);
+  Assert(!variant_is_null(value), "Cannot cast NULL");
+  if (value.which() == detail::index_of(types, hana::type_c<T>) + 1) return get<T>(value);
 
   try {
     return boost::lexical_cast<T>(value);
@@ -36,6 +36,11 @@ namespace opossum {
 
 using ChunkOffset = uint32_t;
 using AttributeVectorWidth = uint8_t;
+using WorkerID = uint32_t;
+using TaskID = uint32_t;
+
+constexpr ChunkID INVALID_CHUNK_ID{std::numeric_limits<ChunkID::base_type>::max()};
+constexpr ChunkOffset INVALID_CHUNK_OFFSET{std::numeric_limits<ChunkOffset>::max()};
 
 struct RowID {
   ChunkID chunk_id;
@@ -49,12 +54,29 @@ struct RowID {
   bool operator==(const RowID& rhs) const {
     return std::tie(chunk_id, chunk_offset) == std::tie(rhs.chunk_id, rhs.chunk_offset);
   }
+
+  bool operator!=(const RowID& rhs) const { return !(*this == rhs); }
 };
 
+// Used in PosLists of ReferenceSegments for rows that do not exist, e.g., the right side of a left outer join if a
+// left row has no join partner. The values at these positions are NULL.
+const RowID NULL_ROW_ID{INVALID_CHUNK_ID, INVALID_CHUNK_OFFSET};
+
 enum class ScanType { OpEquals, OpNotEquals, OpLessThan, OpLessThanEquals, OpGreaterThan, OpGreaterThanEquals };
 
+// Fitted attribute vectors use the smallest of uint8_t/uint16_t/uint32_t, bit-packed ones use exactly as many bits as
+// the dictionary requires
+enum class AttributeVectorType { Fitted, BitPacked };
+
+// the encodings that Table::compress_chunk can apply to the segments of a full chunk
+enum class EncodingType { Dictionary, RunLength, FrameOfReference };
+
 using PosList = std::vector<RowID>;
 
+// Inner joins return all pairs of matching rows. Left (outer) joins additionally return the left rows without a join
+// partner, with NULLs for the right columns. Semi joins return each left row that has at least one join partner.
+enum class JoinMode { Inner, Left, Semi };
+
 // Prevents unnecessary, potentially expensive, copies by deleting copy constructor and copy assignment operator.
 class Noncopyable {
  protected:
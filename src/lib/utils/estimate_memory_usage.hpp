@@ -0,0 +1,40 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace opossum {
+
+// Returns an estimate of the number of bytes that the elements of a vector occupy, not including the vector object
+// itself. Strings that do not fit into the small string buffer store their characters on the heap. To keep this cheap
+// for large segments, only up to STRING_SAMPLE_SIZE evenly spaced strings are inspected and the result is extrapolated.
+template <typename T>
+size_t estimate_vector_memory_usage(const std::vector<T>& values) {
+  auto bytes = values.capacity() * sizeof(T);
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    constexpr size_t STRING_SAMPLE_SIZE = 1000;
+    if (values.empty()) return bytes;
+
+    const auto small_string_capacity = std::string{}.capacity();
+    const auto step = std::max(size_t{1}, values.size() / STRING_SAMPLE_SIZE);
+
+    size_t sampled_count = 0;
+    size_t sampled_heap_bytes = 0;
+    for (size_t index = 0; index < values.size(); index += step) {
+      const auto capacity = values[index].capacity();
+      if (capacity > small_string_capacity) {
+        // one additional byte for the null terminator
+        sampled_heap_bytes += capacity + 1;
+      }
+      ++sampled_count;
+    }
+    bytes += sampled_heap_bytes * values.size() / sampled_count;
+  }
+
+  return bytes;
+}
+
+}  // namespace opossum
@@ -6,6 +6,8 @@
 #include <utility>
 #include <vector>
 
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_scheduler.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "type_cast.hpp"
@@ -157,6 +159,31 @@ void BaseTest::_print_matrix(const BaseTest::Matrix& matrix) {
   return ::testing::AssertionSuccess();
 }
 
-BaseTest::~BaseTest() { StorageManager::get().reset(); }
+std::shared_ptr<Table> BaseTest::_create_table(const std::vector<std::pair<std::string, std::string>>& columns,
+                                               const Matrix& rows) {
+  auto table = std::make_shared<Table>();
+  for (const auto& [name, type] : columns) {
+    table->add_column(name, type);
+  }
+  for (const auto& row : rows) {
+    table->append(row);
+  }
+  return table;
+}
+
+BaseTest::BaseTest() {
+  // The jobs of the operators run on a scheduler with several workers, even on machines with few cores, so that the
+  // tests cover their concurrent execution. Tests can replace it or unset it to run tasks inline.
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+}
+
+BaseTest::~BaseTest() {
+  // Tasks that are still running might use tables that the StorageManager holds, so the scheduler is finished first
+  if (CurrentScheduler::is_set()) {
+    CurrentScheduler::get()->finish();
+    CurrentScheduler::set(nullptr);
+  }
+  StorageManager::get().reset();
+}
 
 }  // namespace opossum
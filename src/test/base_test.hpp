@@ -46,7 +46,13 @@ class BaseTest : public ::testing::Test {
   static void ASSERT_TABLE_EQ(std::shared_ptr<const Table> tleft, std::shared_ptr<const Table> tright,
                               bool order_sensitive = false, bool strict_types = true);
 
+  // creates a table with the given columns, as pairs of name and type, and rows, e.g., the expected output of an
+  // operator
+  static std::shared_ptr<Table> _create_table(const std::vector<std::pair<std::string, std::string>>& columns,
+                                              const Matrix& rows);
+
  public:
+  BaseTest();
   virtual ~BaseTest();
 };
 
@@ -0,0 +1,165 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/arithmetic_expression.hpp"
+#include "expression/case_expression.hpp"
+#include "expression/column_expression.hpp"
+#include "expression/comparison_expression.hpp"
+#include "expression/expression_evaluator.hpp"
+#include "expression/value_expression.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class ExpressionEvaluatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int");
+    _table->add_column("b", "float");
+    _table->add_column("c", "string");
+    _table->add_column("d", "long");
+    _table->append({4, 1.5f, "x", int64_t{10}});
+    _table->append({0, 2.5f, "y", int64_t{20}});
+    _table->append({7, 0.5f, "z", int64_t{30}});
+    _table->compress_chunk(ChunkID{0});
+
+    _a = std::make_shared<ColumnExpression>(ColumnID{0}, "int", "a");
+    _b = std::make_shared<ColumnExpression>(ColumnID{1}, "float", "b");
+    _c = std::make_shared<ColumnExpression>(ColumnID{2}, "string", "c");
+    _d = std::make_shared<ColumnExpression>(ColumnID{3}, "long", "d");
+  }
+
+  template <typename T>
+  ExpressionResult<T> _evaluate(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                                const AbstractExpression& expression) {
+    ExpressionEvaluator evaluator(table, chunk_id);
+    return *evaluator.evaluate<T>(expression);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<AbstractExpression> _a;
+  std::shared_ptr<AbstractExpression> _b;
+  std::shared_ptr<AbstractExpression> _c;
+  std::shared_ptr<AbstractExpression> _d;
+};
+
+TEST_F(ExpressionEvaluatorTest, Arithmetic) {
+  // (a + 1) * d, with the int converted to long
+  const auto a_plus_one = std::make_shared<ArithmeticExpression>(ArithmeticOperator::Addition, _a,
+                                                                 std::make_shared<ValueExpression>(1));
+  const auto product = std::make_shared<ArithmeticExpression>(ArithmeticOperator::Multiplication, a_plus_one, _d);
+  EXPECT_EQ(product->data_type(), "long");
+  EXPECT_EQ(product->description(), "(a + 1) * d");
+  EXPECT_EQ(_evaluate<int64_t>(_table, ChunkID{0}, *product).values, std::vector<int64_t>({50, 20}));
+  EXPECT_EQ(_evaluate<int64_t>(_table, ChunkID{1}, *product).values, std::vector<int64_t>({240}));
+
+  // b - a, with the int converted to float
+  const auto difference = std::make_shared<ArithmeticExpression>(ArithmeticOperator::Subtraction, _b, _a);
+  EXPECT_EQ(difference->data_type(), "float");
+  EXPECT_EQ(_evaluate<float>(_table, ChunkID{0}, *difference).values, std::vector<float>({-2.5f, 2.5f}));
+
+  // Literals only result in a single value
+  const auto literals = std::make_shared<ArithmeticExpression>(
+      ArithmeticOperator::Subtraction, std::make_shared<ValueExpression>(2.5), std::make_shared<ValueExpression>(1));
+  EXPECT_EQ(literals->data_type(), "double");
+  EXPECT_EQ(_evaluate<double>(_table, ChunkID{0}, *literals).values, std::vector<double>({1.5}));
+
+  EXPECT_THROW(std::make_shared<ArithmeticExpression>(ArithmeticOperator::Addition, _a, _c), std::exception);
+}
+
+TEST_F(ExpressionEvaluatorTest, DivisionByZero) {
+  // Integers are divided without remainder, and a division by zero is NULL
+  const auto quotient = std::make_shared<ArithmeticExpression>(ArithmeticOperator::Division, _d, _a);
+  const auto result = _evaluate<int64_t>(_table, ChunkID{0}, *quotient);
+  EXPECT_EQ(result.values[0], 2);
+  EXPECT_FALSE(result.is_null(0));
+  EXPECT_TRUE(result.is_null(1));
+}
+
+TEST_F(ExpressionEvaluatorTest, Comparison) {
+  const auto greater = std::make_shared<ComparisonExpression>(ScanType::OpGreaterThan, _b, _a);
+  EXPECT_EQ(greater->data_type(), "int");
+  EXPECT_EQ(greater->description(), "b > a");
+  EXPECT_EQ(_evaluate<int32_t>(_table, ChunkID{0}, *greater).values, std::vector<int32_t>({0, 1}));
+
+  const auto strings = std::make_shared<ComparisonExpression>(ScanType::OpLessThanEquals, _c,
+                                                              std::make_shared<ValueExpression>("y"));
+  EXPECT_EQ(strings->description(), "c <= 'y'");
+  EXPECT_EQ(_evaluate<int32_t>(_table, ChunkID{0}, *strings).values, std::vector<int32_t>({1, 1}));
+  EXPECT_EQ(_evaluate<int32_t>(_table, ChunkID{1}, *strings).values, std::vector<int32_t>({0}));
+
+  EXPECT_THROW(std::make_shared<ComparisonExpression>(ScanType::OpEquals, _a, _c), std::exception);
+}
+
+TEST_F(ExpressionEvaluatorTest, Case) {
+  // CASE WHEN a > 3 THEN b ELSE d END, with both results converted to float
+  const auto condition =
+      std::make_shared<ComparisonExpression>(ScanType::OpGreaterThan, _a, std::make_shared<ValueExpression>(3));
+  const auto case_expression = std::make_shared<CaseExpression>(condition, _b, _d);
+  EXPECT_EQ(case_expression->data_type(), "float");
+  EXPECT_EQ(case_expression->description(), "CASE WHEN a > 3 THEN b ELSE d END");
+  EXPECT_EQ(_evaluate<float>(_table, ChunkID{0}, *case_expression).values, std::vector<float>({1.5f, 20.0f}));
+
+  const auto strings = std::make_shared<CaseExpression>(_a, _c, std::make_shared<ValueExpression>("none"));
+  EXPECT_EQ(_evaluate<std::string>(_table, ChunkID{0}, *strings).values, std::vector<std::string>({"x", "none"}));
+
+  EXPECT_THROW(std::make_shared<CaseExpression>(_c, _a, _b), std::exception);
+  EXPECT_THROW(std::make_shared<CaseExpression>(_a, _a, _c), std::exception);
+}
+
+TEST_F(ExpressionEvaluatorTest, NullValues) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("e", "int");
+  right_table->append({4});
+  auto left = std::make_shared<TableWrapper>(_table);
+  left->execute();
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+  auto join = std::make_shared<JoinHash>(left, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  // Only the first row has a join partner, so e is NULL in all other rows, and so are expressions that use it
+  const auto join_table = join->get_output();
+  ChunkID chunk_id{0};
+  while (join_table->get_chunk(chunk_id).size() < 2) ++chunk_id;
+  const auto e = std::make_shared<ColumnExpression>(ColumnID{4}, "int", "e");
+  const auto sum = std::make_shared<ArithmeticExpression>(ArithmeticOperator::Addition, _a, e);
+  const auto result = _evaluate<int32_t>(join_table, chunk_id, *sum);
+  EXPECT_NE(result.is_null(0), result.is_null(1));
+
+  // A NULL condition is false
+  const auto case_expression = std::make_shared<CaseExpression>(
+      std::make_shared<ComparisonExpression>(ScanType::OpEquals, e, _a), std::make_shared<ValueExpression>(1),
+      std::make_shared<ValueExpression>(2));
+  const auto case_result = _evaluate<int32_t>(join_table, chunk_id, *case_expression);
+  EXPECT_TRUE(case_result.nulls.empty());
+  EXPECT_EQ(case_result.values[0] + case_result.values[1], 3);
+
+  // NULLs cannot be stored in ValueSegments
+  ExpressionEvaluator evaluator(join_table, chunk_id);
+  EXPECT_THROW(evaluator.evaluate_to_segment(*sum), std::exception);
+}
+
+TEST_F(ExpressionEvaluatorTest, EvaluateToSegment) {
+  ExpressionEvaluator evaluator(_table, ChunkID{0});
+  const auto segment = std::dynamic_pointer_cast<ValueSegment<std::string>>(
+      evaluator.evaluate_to_segment(ValueExpression{std::string{"literal"}}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->values(), std::vector<std::string>({"literal", "literal"}));
+
+  const auto column_segment = std::dynamic_pointer_cast<ValueSegment<int32_t>>(evaluator.evaluate_to_segment(*_a));
+  ASSERT_TRUE(column_segment);
+  EXPECT_EQ(column_segment->values(), std::vector<int32_t>({4, 0}));
+}
+
+}  // namespace opossum
@@ -73,4 +73,16 @@ TEST_F(AllTypeVariantTest, GetExtractsExactNumericalValue) {
   }
 }
 
+TEST_F(AllTypeVariantTest, NullValue) {
+  EXPECT_TRUE(variant_is_null(NULL_VALUE));
+  EXPECT_TRUE(variant_is_null(AllTypeVariant{}));
+  EXPECT_FALSE(variant_is_null(AllTypeVariant{0}));
+  EXPECT_EQ(NULL_VALUE, AllTypeVariant{NullValue{}});
+  EXPECT_NE(NULL_VALUE, AllTypeVariant{0});
+  EXPECT_EQ(boost::lexical_cast<std::string>(NULL_VALUE), "NULL");
+  EXPECT_THROW(type_cast<int32_t>(NULL_VALUE), std::exception);
+  EXPECT_THROW(type_cast<float>(NULL_VALUE), std::exception);
+  EXPECT_THROW(type_cast<std::string>(NULL_VALUE), std::exception);
+}
+
 }  // namespace opossum
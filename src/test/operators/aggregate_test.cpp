@@ -0,0 +1,169 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks of three rows, with different encodings and dictionaries
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "int");
+    table->add_column("d", "float");
+    table->append({1, "x", 10, 1.5f});
+    table->append({2, "y", 20, 2.5f});
+    table->append({1, "y", 30, 3.5f});
+    table->append({3, "x", 40, 4.5f});
+    table->append({1, "x", 50, 5.5f});
+    table->append({2, "z", 60, 6.5f});
+    table->append({3, "x", 70, 7.5f});
+    table->append({2, "y", 100, 8.5f});
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsAggregateTest, SingleGroupByColumn) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Sum},
+                                             {ColumnID{2}, AggregateFunction::Avg},
+                                             {ColumnID{3}, AggregateFunction::Min},
+                                             {ColumnID{1}, AggregateFunction::Max},
+                                             {std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  const auto expected = _create_table(
+      {{"a", "int"}, {"SUM(c)", "long"}, {"AVG(c)", "double"}, {"MIN(d)", "float"}, {"MAX(b)", "string"},
+       {"COUNT(*)", "long"}},
+      {{1, int64_t{90}, 30.0, 1.5f, "y", int64_t{3}},
+       {2, int64_t{180}, 60.0, 2.5f, "z", int64_t{3}},
+       {3, int64_t{110}, 55.0, 4.5f, "x", int64_t{2}}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, StringGroupByColumn) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Max},
+                                             {ColumnID{3}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{1}});
+  aggregate->execute();
+
+  const auto expected = _create_table({{"b", "string"}, {"MAX(a)", "int"}, {"SUM(d)", "double"}},
+                                      {{"x", 3, 19.0}, {"y", 2, 14.5}, {"z", 2, 6.5}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, MultipleGroupByColumns) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Sum},
+                                             {ColumnID{2}, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{1}, ColumnID{0}});
+  aggregate->execute();
+
+  const auto expected = _create_table(
+      {{"b", "string"}, {"a", "int"}, {"SUM(c)", "long"}, {"COUNT(c)", "long"}},
+      {{"x", 1, int64_t{60}, int64_t{2}},
+       {"y", 2, int64_t{120}, int64_t{2}},
+       {"y", 1, int64_t{30}, int64_t{1}},
+       {"x", 3, int64_t{110}, int64_t{2}},
+       {"z", 2, int64_t{60}, int64_t{1}}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+}
+
+TEST_F(OperatorsAggregateTest, NoGroupByColumns) {
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Sum},
+                                                                 {ColumnID{1}, AggregateFunction::Min},
+                                                                 {std::nullopt, AggregateFunction::Count}};
+  auto aggregate = std::make_shared<Aggregate>(_table_wrapper, aggregates, std::vector<ColumnID>{});
+  aggregate->execute();
+  EXPECT_TABLE_EQ(aggregate->get_output(),
+                  _create_table({{"SUM(c)", "long"}, {"MIN(b)", "string"}, {"COUNT(*)", "long"}},
+                                {{int64_t{380}, "x", int64_t{8}}}));
+
+  // An empty input still results in a single row
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 5);
+  scan->execute();
+  auto empty_aggregate = std::make_shared<Aggregate>(scan, aggregates, std::vector<ColumnID>{});
+  empty_aggregate->execute();
+  EXPECT_TABLE_EQ(empty_aggregate->get_output(),
+                  _create_table({{"SUM(c)", "long"}, {"MIN(b)", "string"}, {"COUNT(*)", "long"}},
+                                {{int64_t{0}, "", int64_t{0}}}));
+
+  // With group-by columns, it results in no rows
+  auto empty_groups = std::make_shared<Aggregate>(scan, aggregates, std::vector<ColumnID>{ColumnID{0}});
+  empty_groups->execute();
+  EXPECT_EQ(empty_groups->get_output()->row_count(), 0u);
+  EXPECT_EQ(empty_groups->get_output()->column_count(), 4u);
+}
+
+TEST_F(OperatorsAggregateTest, NullValues) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("e", "int");
+  right_table->append({1});
+  right_table->append({2});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // The rows with a = 3 have no join partner, so e is NULL for them
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  // Aggregates ignore NULLs
+  auto aggregate = std::make_shared<Aggregate>(
+      join,
+      std::vector<AggregateColumnDefinition>{{ColumnID{4}, AggregateFunction::Count},
+                                             {ColumnID{4}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+  const auto expected = _create_table(
+      {{"a", "int"}, {"COUNT(e)", "long"}, {"SUM(e)", "long"}},
+      {{1, int64_t{3}, int64_t{3}}, {2, int64_t{3}, int64_t{6}}, {3, int64_t{0}, int64_t{0}}});
+  EXPECT_TABLE_EQ(aggregate->get_output(), expected);
+
+  // Rows with NULLs in group-by columns are not part of any group
+  auto null_groups = std::make_shared<Aggregate>(
+      join, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{4}, ColumnID{1}});
+  null_groups->execute();
+  const auto expected_groups = _create_table(
+      {{"e", "int"}, {"b", "string"}, {"COUNT(*)", "long"}},
+      {{1, "x", int64_t{2}}, {1, "y", int64_t{1}}, {2, "y", int64_t{2}}, {2, "z", int64_t{1}}});
+  EXPECT_TABLE_EQ(null_groups->get_output(), expected_groups);
+}
+
+TEST_F(OperatorsAggregateTest, InvalidAggregates) {
+  EXPECT_THROW(std::make_shared<Aggregate>(
+                   _table_wrapper, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Min}},
+                   std::vector<ColumnID>{}),
+               std::exception);
+
+  auto string_sum = std::make_shared<Aggregate>(
+      _table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_THROW(string_sum->execute(), std::exception);
+}
+
+}  // namespace opossum
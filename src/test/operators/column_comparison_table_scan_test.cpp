@@ -0,0 +1,194 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/column_comparison_table_scan.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsColumnComparisonTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks of 100 rows. The first two chunks are dictionary-encoded and the third one is run-length-encoded. The
+    // fourth one mixes encodings: a is dictionary-encoded and d is run-length-encoded. The last chunk is uncompressed.
+    auto table = std::make_shared<Table>(100);
+    table->add_column("a", "int");
+    table->add_column("b", "int");
+    table->add_column("c", "float");
+    table->add_column("d", "string");
+    table->add_column("e", "string");
+    for (int32_t i = 0; i < _row_count; ++i) {
+      table->append({_a(i), _b(i), _c(i), _d(i), _e(i)});
+    }
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{1}, EncodingType::Dictionary, AttributeVectorType::BitPacked);
+    table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+    auto& mixed_chunk = table->get_chunk(ChunkID{3});
+    mixed_chunk.replace_segment(ColumnID{0},
+                                std::make_shared<DictionarySegment<int32_t>>(mixed_chunk.get_segment(ColumnID{0})));
+    mixed_chunk.replace_segment(ColumnID{3},
+                                std::make_shared<RunLengthSegment<std::string>>(mixed_chunk.get_segment(ColumnID{3})));
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  static int32_t _a(const int32_t i) { return (i * 7) % 31; }
+  static int32_t _b(const int32_t i) { return (i * 3) % 29; }
+  static float _c(const int32_t i) { return static_cast<float>(i % 40) / 2; }
+  static std::string _d(const int32_t i) { return std::to_string(i % 17); }
+  static std::string _e(const int32_t i) { return std::to_string(i % 19); }
+
+  // Returns the row ids of the input table for which the predicate holds, in their order in the input table
+  template <typename Predicate>
+  std::vector<int32_t> _expected_rows(const Predicate& predicate) {
+    std::vector<int32_t> rows;
+    for (int32_t i = 0; i < _row_count; ++i) {
+      if (predicate(i)) rows.emplace_back(i);
+    }
+    return rows;
+  }
+
+  // Returns the rows of the output by their values of a, b, and c, which identify them
+  std::vector<int32_t> _output_rows(const std::shared_ptr<const AbstractOperator>& input, const ColumnID left_column_id,
+                                    const ScanType scan_type, const ColumnID right_column_id) {
+    auto scan = std::make_shared<ColumnComparisonTableScan>(input, left_column_id, scan_type, right_column_id);
+    scan->execute();
+    const auto output = scan->get_output();
+
+    std::vector<int32_t> rows;
+    for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto& chunk = output->get_chunk(chunk_id);
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+        const auto a = type_cast<int32_t>((*chunk.get_segment(ColumnID{0}))[chunk_offset]);
+        const auto b = type_cast<int32_t>((*chunk.get_segment(ColumnID{1}))[chunk_offset]);
+        const auto c = type_cast<float>((*chunk.get_segment(ColumnID{2}))[chunk_offset]);
+        rows.emplace_back(_row_of(a, b, c));
+      }
+    }
+    return rows;
+  }
+
+  int32_t _row_of(const int32_t a, const int32_t b, const float c) const {
+    for (int32_t i = 0; i < _row_count; ++i) {
+      if (_a(i) == a && _b(i) == b && _c(i) == c) return i;
+    }
+    return -1;
+  }
+
+  static constexpr int32_t _row_count = 450;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsColumnComparisonTableScanTest, SameTypes) {
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{0}, ScanType::OpEquals, ColumnID{1}),
+            _expected_rows([](int32_t i) { return _a(i) == _b(i); }));
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{0}, ScanType::OpNotEquals, ColumnID{1}),
+            _expected_rows([](int32_t i) { return _a(i) != _b(i); }));
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, ColumnID{1}),
+            _expected_rows([](int32_t i) { return _a(i) < _b(i); }));
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{0}, ScanType::OpLessThanEquals, ColumnID{1}),
+            _expected_rows([](int32_t i) { return _a(i) <= _b(i); }));
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, ColumnID{1}),
+            _expected_rows([](int32_t i) { return _a(i) > _b(i); }));
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, ColumnID{1}),
+            _expected_rows([](int32_t i) { return _a(i) >= _b(i); }));
+
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{3}, ScanType::OpLessThan, ColumnID{4}),
+            _expected_rows([](int32_t i) { return _d(i) < _e(i); }));
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{4}, ScanType::OpEquals, ColumnID{3}),
+            _expected_rows([](int32_t i) { return _d(i) == _e(i); }));
+}
+
+TEST_F(OperatorsColumnComparisonTableScanTest, DifferentTypes) {
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{2}, ScanType::OpGreaterThan, ColumnID{0}),
+            _expected_rows([](int32_t i) { return _c(i) > static_cast<float>(_a(i)); }));
+  EXPECT_EQ(_output_rows(_table_wrapper, ColumnID{1}, ScanType::OpEquals, ColumnID{2}),
+            _expected_rows([](int32_t i) { return static_cast<float>(_b(i)) == _c(i); }));
+
+  auto scan = std::make_shared<ColumnComparisonTableScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, ColumnID{3});
+  EXPECT_THROW(scan->execute(), std::exception);
+}
+
+TEST_F(OperatorsColumnComparisonTableScanTest, ReferencedInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpLessThan, 10.0f);
+  scan->execute();
+  EXPECT_EQ(_output_rows(scan, ColumnID{0}, ScanType::OpLessThanEquals, ColumnID{1}),
+            _expected_rows([](int32_t i) { return _c(i) < 10.0f && _a(i) <= _b(i); }));
+  EXPECT_EQ(_output_rows(scan, ColumnID{3}, ScanType::OpGreaterThanEquals, ColumnID{4}),
+            _expected_rows([](int32_t i) { return _c(i) < 10.0f && _d(i) >= _e(i); }));
+
+  auto column_scan = std::make_shared<ColumnComparisonTableScan>(scan, ColumnID{0}, ScanType::OpLessThan, ColumnID{1});
+  column_scan->execute();
+  const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(
+      column_scan->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsColumnComparisonTableScanTest, PruneChunks) {
+  auto table = std::make_shared<Table>(10);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (int32_t i = 0; i < 30; ++i) table->append({i, 15});
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // a is [0, 9] in the first chunk and [10, 19] in the second one, b is always 15. The last chunk has no statistics.
+  auto greater_scan =
+      std::make_shared<ColumnComparisonTableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, ColumnID{1});
+  greater_scan->execute();
+  EXPECT_EQ(greater_scan->pruned_chunk_count(), 1u);
+  EXPECT_EQ(greater_scan->get_output()->row_count(), 14u);
+
+  auto equal_scan =
+      std::make_shared<ColumnComparisonTableScan>(table_wrapper, ColumnID{0}, ScanType::OpEquals, ColumnID{1});
+  equal_scan->execute();
+  EXPECT_EQ(equal_scan->pruned_chunk_count(), 1u);
+  EXPECT_EQ(equal_scan->get_output()->row_count(), 1u);
+
+  auto not_equal_scan =
+      std::make_shared<ColumnComparisonTableScan>(table_wrapper, ColumnID{1}, ScanType::OpNotEquals, ColumnID{1});
+  not_equal_scan->execute();
+  EXPECT_EQ(not_equal_scan->pruned_chunk_count(), 2u);
+  EXPECT_EQ(not_equal_scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(not_equal_scan->get_output()->get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+TEST_F(OperatorsColumnComparisonTableScanTest, NullValues) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("f", "int");
+  right_table->append({7});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // Only the rows with a = 7 have a join partner, so f is NULL for all others. The join does not keep the order of the
+  // rows, so they are compared sorted.
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  auto equal_rows = _output_rows(join, ColumnID{5}, ScanType::OpEquals, ColumnID{0});
+  std::sort(equal_rows.begin(), equal_rows.end());
+  EXPECT_EQ(equal_rows, _expected_rows([](int32_t i) { return _a(i) == 7; }));
+
+  auto not_equal_rows = _output_rows(join, ColumnID{1}, ScanType::OpNotEquals, ColumnID{5});
+  std::sort(not_equal_rows.begin(), not_equal_rows.end());
+  EXPECT_EQ(not_equal_rows, _expected_rows([](int32_t i) { return _a(i) == 7 && _b(i) != 7; }));
+}
+
+}  // namespace opossum
@@ -0,0 +1,152 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "multi_predicate_table_scan_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/conjunctive_table_scan.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsConjunctiveTableScanTest : public MultiPredicateTableScanTest {
+ protected:
+  // Compares the output of a ConjunctiveTableScan with that of one TableScan per predicate
+  void _expect_same_as_chained_scans(const std::shared_ptr<const AbstractOperator>& input,
+                                     const std::vector<ScanPredicate>& predicates) {
+    auto conjunctive_scan = std::make_shared<ConjunctiveTableScan>(input, predicates);
+    conjunctive_scan->execute();
+
+    auto chained_scan = input;
+    for (const auto& predicate : predicates) {
+      auto scan = std::make_shared<TableScan>(chained_scan, predicate.column_id, predicate.scan_type,
+                                              predicate.search_value);
+      scan->execute();
+      chained_scan = scan;
+    }
+    EXPECT_TABLE_EQ(conjunctive_scan->get_output(), chained_scan->get_output(), true);
+  }
+};
+
+TEST_F(OperatorsConjunctiveTableScanTest, SameAsChainedScans) {
+  _expect_same_as_chained_scans(_table_wrapper, {{ColumnID{0}, ScanType::OpGreaterThan, 20},
+                                                 {ColumnID{0}, ScanType::OpLessThanEquals, 100},
+                                                 {ColumnID{1}, ScanType::OpLessThan, 10.0f}});
+  _expect_same_as_chained_scans(
+      _table_wrapper, {{ColumnID{2}, ScanType::OpEquals, "7"}, {ColumnID{0}, ScanType::OpGreaterThanEquals, 3}});
+  _expect_same_as_chained_scans(_table_wrapper, {{ColumnID{0}, ScanType::OpNotEquals, 5},
+                                                 {ColumnID{0}, ScanType::OpNotEquals, 6},
+                                                 {ColumnID{2}, ScanType::OpNotEquals, "12"}});
+  _expect_same_as_chained_scans(_table_wrapper, {{ColumnID{1}, ScanType::OpGreaterThan, 3.5f},
+                                                 {ColumnID{1}, ScanType::OpGreaterThan, 3.0f},
+                                                 {ColumnID{1}, ScanType::OpLessThan, 3.75f}});
+
+  // Bounds that lie between the values of the dictionaries and outside of them
+  _expect_same_as_chained_scans(_table_wrapper, {{ColumnID{2}, ScanType::OpGreaterThan, "10a"},
+                                                 {ColumnID{2}, ScanType::OpLessThan, "5a"},
+                                                 {ColumnID{0}, ScanType::OpLessThan, 1000}});
+  _expect_same_as_chained_scans(_table_wrapper, {{ColumnID{0}, ScanType::OpGreaterThan, -5}});
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, Between) {
+  auto predicates = between_predicates(ColumnID{0}, 10, 20);
+  _expect_same_as_chained_scans(_table_wrapper, predicates);
+
+  auto scan = std::make_shared<ConjunctiveTableScan>(_table_wrapper, predicates);
+  scan->execute();
+  // Every value of a appears 18 times
+  EXPECT_EQ(scan->get_output()->row_count(), 11u * 18u);
+
+  _expect_same_as_chained_scans(_table_wrapper, between_predicates(ColumnID{2}, "2", "4"));
+  _expect_same_as_chained_scans(_table_wrapper, between_predicates(ColumnID{1}, 5.0f, 5.0f));
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, ReferencedInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpLessThan, "5");
+  scan->execute();
+  _expect_same_as_chained_scans(scan, {{ColumnID{0}, ScanType::OpLessThan, 100},
+                                       {ColumnID{1}, ScanType::OpGreaterThanEquals, 20.0f},
+                                       {ColumnID{2}, ScanType::OpNotEquals, "3"}});
+
+  auto conjunctive_scan = std::make_shared<ConjunctiveTableScan>(scan, between_predicates(ColumnID{0}, 0, 100));
+  conjunctive_scan->execute();
+  const auto& output_chunk = conjunctive_scan->get_output()->get_chunk(ChunkID{0});
+  const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(output_chunk.get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, FrameOfReference) {
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (int32_t i = 0; i < 250; ++i) table->append({i - 100, i % 10});
+  table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+  table->compress_chunk(ChunkID{1}, EncodingType::FrameOfReference);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  _expect_same_as_chained_scans(table_wrapper, {{ColumnID{0}, ScanType::OpGreaterThan, -50},
+                                                {ColumnID{0}, ScanType::OpLessThan, 120},
+                                                {ColumnID{1}, ScanType::OpEquals, 3}});
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, PruneChunks) {
+  // The statistics of a are [0, 249] and those of b are [0, 49.5] in every compressed chunk, the uncompressed last
+  // chunk has none. The predicates on a alone do not rule out any chunk.
+  auto outside_scan = std::make_shared<ConjunctiveTableScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThan, 100},
+                                                 {ColumnID{1}, ScanType::OpGreaterThan, 50.0f}});
+  outside_scan->execute();
+  EXPECT_EQ(outside_scan->pruned_chunk_count(), 4u);
+  EXPECT_EQ(outside_scan->get_output()->row_count(), 0u);
+
+  // Contradicting predicates rule out every chunk, even without statistics
+  auto contradiction_scan = std::make_shared<ConjunctiveTableScan>(
+      _table_wrapper,
+      std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpLessThan, 10}, {ColumnID{0}, ScanType::OpGreaterThan, 10}});
+  contradiction_scan->execute();
+  EXPECT_EQ(contradiction_scan->pruned_chunk_count(), 5u);
+  EXPECT_EQ(contradiction_scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(contradiction_scan->get_output()->get_chunk(ChunkID{0}).column_count(), 3u);
+
+  auto empty_between_scan =
+      std::make_shared<ConjunctiveTableScan>(_table_wrapper, between_predicates(ColumnID{0}, 20, 10));
+  empty_between_scan->execute();
+  EXPECT_EQ(empty_between_scan->pruned_chunk_count(), 5u);
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, NullValues) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  right_table->append({7});
+  right_table->append({14});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // Only the rows with a = 7 or a = 14 have a join partner, so d is NULL for all others
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  auto scan =
+      std::make_shared<ConjunctiveTableScan>(join, std::vector<ScanPredicate>{{ColumnID{3}, ScanType::OpNotEquals, 7}});
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 18u);
+
+  _expect_same_as_chained_scans(join, {{ColumnID{3}, ScanType::OpGreaterThanEquals, 7},
+                                       {ColumnID{1}, ScanType::OpLessThan, 40.0f}});
+}
+
+TEST_F(OperatorsConjunctiveTableScanTest, RequiresPredicates) {
+  EXPECT_THROW(std::make_shared<ConjunctiveTableScan>(_table_wrapper, std::vector<ScanPredicate>{}), std::exception);
+}
+
+}  // namespace opossum
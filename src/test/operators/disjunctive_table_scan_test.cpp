@@ -0,0 +1,135 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "multi_predicate_table_scan_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/disjunctive_table_scan.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsDisjunctiveTableScanTest : public MultiPredicateTableScanTest {
+ protected:
+  std::shared_ptr<const Table> _scan(const std::shared_ptr<const AbstractOperator>& input,
+                                     const std::vector<ScanPredicate>& predicates) {
+    auto scan = std::make_shared<DisjunctiveTableScan>(input, predicates);
+    scan->execute();
+    return scan->get_output();
+  }
+};
+
+TEST_F(OperatorsDisjunctiveTableScanTest, InList) {
+  EXPECT_TABLE_EQ(_scan(_table_wrapper, in_predicates(ColumnID{0}, {3, 17, 17, 240, 1000})),
+                  _expected_table([](int32_t a, float, const std::string&) { return a == 3 || a == 17 || a == 240; }),
+                  true);
+  EXPECT_TABLE_EQ(
+      _scan(_table_wrapper, in_predicates(ColumnID{2}, {"1", "12", "x"})),
+      _expected_table([](int32_t, float, const std::string& c) { return c == "1" || c == "12"; }), true);
+
+  // A long IN-list, of which only every third value exists
+  std::vector<AllTypeVariant> values;
+  for (int32_t value = -3000; value < 3000; value += 3) values.emplace_back(value);
+  EXPECT_TABLE_EQ(_scan(_table_wrapper, in_predicates(ColumnID{0}, values)),
+                  _expected_table([](int32_t a, float, const std::string&) { return a % 3 == 0; }), true);
+
+  EXPECT_EQ(_scan(_table_wrapper, in_predicates(ColumnID{0}, {-1, 250}))->row_count(), 0u);
+}
+
+TEST_F(OperatorsDisjunctiveTableScanTest, MultipleColumns) {
+  EXPECT_TABLE_EQ(_scan(_table_wrapper, {{ColumnID{0}, ScanType::OpEquals, 5},
+                                         {ColumnID{1}, ScanType::OpLessThan, 2.0f},
+                                         {ColumnID{2}, ScanType::OpEquals, "7"}}),
+                  _expected_table([](int32_t a, float b, const std::string& c) {
+                    return a == 5 || b < 2.0f || c == "7";
+                  }),
+                  true);
+
+  EXPECT_TABLE_EQ(
+      _scan(_table_wrapper, {{ColumnID{0}, ScanType::OpLessThanEquals, 10},
+                             {ColumnID{0}, ScanType::OpGreaterThan, 240},
+                             {ColumnID{0}, ScanType::OpEquals, 100},
+                             {ColumnID{2}, ScanType::OpGreaterThanEquals, "8"}}),
+      _expected_table([](int32_t a, float, const std::string& c) {
+        return a <= 10 || a > 240 || a == 100 || c >= "8";
+      }),
+      true);
+}
+
+TEST_F(OperatorsDisjunctiveTableScanTest, NotEquals) {
+  // The value excluded by OpNotEquals still matches if another predicate includes it
+  EXPECT_TABLE_EQ(_scan(_table_wrapper, {{ColumnID{0}, ScanType::OpNotEquals, 5},
+                                         {ColumnID{0}, ScanType::OpGreaterThanEquals, 5}}),
+                  _expected_table([](int32_t, float, const std::string&) { return true; }), true);
+  EXPECT_TABLE_EQ(_scan(_table_wrapper, {{ColumnID{2}, ScanType::OpNotEquals, "5"}}),
+                  _expected_table([](int32_t, float, const std::string& c) { return c != "5"; }), true);
+  EXPECT_TABLE_EQ(
+      _scan(_table_wrapper, {{ColumnID{0}, ScanType::OpNotEquals, 5}, {ColumnID{0}, ScanType::OpNotEquals, 6}}),
+      _expected_table([](int32_t, float, const std::string&) { return true; }), true);
+}
+
+TEST_F(OperatorsDisjunctiveTableScanTest, ReferencedInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, ScanType::OpLessThan, 10.0f);
+  scan->execute();
+  EXPECT_TABLE_EQ(_scan(scan, {{ColumnID{0}, ScanType::OpEquals, 7}, {ColumnID{2}, ScanType::OpEquals, "3"}}),
+                  _expected_table([](int32_t a, float b, const std::string& c) {
+                    return b < 10.0f && (a == 7 || c == "3");
+                  }),
+                  true);
+
+  const auto output = _scan(scan, in_predicates(ColumnID{0}, {7, 8}));
+  const auto segment =
+      std::dynamic_pointer_cast<ReferenceSegment>(output->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsDisjunctiveTableScanTest, PruneChunks) {
+  // The statistics of a are [0, 249] and those of b are [0, 49.5] in every compressed chunk, the uncompressed last
+  // chunk has none. A chunk is only pruned if none of the predicates can match.
+  auto outside_scan = std::make_shared<DisjunctiveTableScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpEquals, 300},
+                                                 {ColumnID{0}, ScanType::OpLessThan, 0},
+                                                 {ColumnID{1}, ScanType::OpGreaterThan, 50.0f}});
+  outside_scan->execute();
+  EXPECT_EQ(outside_scan->pruned_chunk_count(), 4u);
+  EXPECT_EQ(outside_scan->get_output()->row_count(), 0u);
+  EXPECT_EQ(outside_scan->get_output()->get_chunk(ChunkID{0}).column_count(), 3u);
+
+  auto partially_outside_scan = std::make_shared<DisjunctiveTableScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpEquals, 300},
+                                                 {ColumnID{1}, ScanType::OpEquals, 1.5f}});
+  partially_outside_scan->execute();
+  EXPECT_EQ(partially_outside_scan->pruned_chunk_count(), 0u);
+  EXPECT_EQ(partially_outside_scan->get_output()->row_count(), 45u);
+}
+
+TEST_F(OperatorsDisjunctiveTableScanTest, NullValues) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  right_table->append({7});
+  right_table->append({14});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // Only the rows with a = 7 or a = 14 have a join partner, so d is NULL for all others
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  EXPECT_EQ(_scan(join, {{ColumnID{3}, ScanType::OpNotEquals, 7}})->row_count(), 18u);
+  EXPECT_EQ(_scan(join, in_predicates(ColumnID{3}, {7, 14, 21}))->row_count(), 36u);
+}
+
+TEST_F(OperatorsDisjunctiveTableScanTest, RequiresPredicates) {
+  EXPECT_THROW(std::make_shared<DisjunctiveTableScan>(_table_wrapper, std::vector<ScanPredicate>{}), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,258 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinHashTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks of two rows, so that matches are spread over several chunks on both sides
+    auto left_table = std::make_shared<Table>(2);
+    left_table->add_column("a", "int");
+    left_table->add_column("b", "string");
+    left_table->append({1, "one"});
+    left_table->append({2, "two"});
+    left_table->append({3, "three"});
+    left_table->append({2, "zwei"});
+    left_table->append({5, "five"});
+    left_table->compress_chunk(ChunkID{0});
+    _left = std::make_shared<TableWrapper>(left_table);
+    _left->execute();
+
+    auto right_table = std::make_shared<Table>(2);
+    right_table->add_column("c", "int");
+    right_table->add_column("d", "float");
+    right_table->append({2, 2.5f});
+    right_table->append({4, 4.5f});
+    right_table->append({2, 2.75f});
+    right_table->append({1, 1.5f});
+    right_table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _right = std::make_shared<TableWrapper>(right_table);
+    _right->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _left;
+  std::shared_ptr<TableWrapper> _right;
+};
+
+TEST_F(OperatorsJoinHashTest, InnerJoin) {
+  const auto expected = _create_table({{"a", "int"}, {"b", "string"}, {"c", "int"}, {"d", "float"}},
+                                      {{1, "one", 1, 1.5f},
+                                       {2, "two", 2, 2.5f},
+                                       {2, "two", 2, 2.75f},
+                                       {2, "zwei", 2, 2.5f},
+                                       {2, "zwei", 2, 2.75f}});
+
+  // The right input is smaller, so the hash table is built on it
+  auto join = std::make_shared<JoinHash>(_left, _right, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(), expected);
+
+  // Building on the left input gives the same result, with the columns in the same order
+  auto scan = std::make_shared<TableScan>(_left, ColumnID{0}, ScanType::OpLessThan, 3);
+  scan->execute();
+  auto join_with_smaller_left =
+      std::make_shared<JoinHash>(scan, _right, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join_with_smaller_left->execute();
+  EXPECT_TABLE_EQ(join_with_smaller_left->get_output(), expected);
+}
+
+TEST_F(OperatorsJoinHashTest, OutputReferencesInputTables) {
+  auto scan = std::make_shared<TableScan>(_left, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+  auto join = std::make_shared<JoinHash>(scan, _right, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  // The columns of the scan output are resolved to the table that the scan references
+  const auto& output_chunk = join->get_output()->get_chunk(ChunkID{0});
+  const auto left_segment = std::dynamic_pointer_cast<ReferenceSegment>(output_chunk.get_segment(ColumnID{1}));
+  const auto right_segment = std::dynamic_pointer_cast<ReferenceSegment>(output_chunk.get_segment(ColumnID{3}));
+  ASSERT_TRUE(left_segment && right_segment);
+  EXPECT_EQ(left_segment->referenced_table(), _left->get_output());
+  EXPECT_EQ(right_segment->referenced_table(), _right->get_output());
+
+  // Joining the join output again works on the columns of both of its inputs
+  auto second_join =
+      std::make_shared<JoinHash>(join, _right, JoinMode::Inner, std::make_pair(ColumnID{2}, ColumnID{0}));
+  second_join->execute();
+  EXPECT_EQ(second_join->get_output()->row_count(), 8u);
+  EXPECT_EQ(second_join->get_output()->column_count(), 6u);
+}
+
+TEST_F(OperatorsJoinHashTest, LeftJoin) {
+  auto join = std::make_shared<JoinHash>(_left, _right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+  const auto output = join->get_output();
+  EXPECT_EQ(output->row_count(), 7u);
+  EXPECT_EQ(output->column_count(), 4u);
+
+  // Rows without a join partner have NULLs in the right columns
+  auto null_count = 0;
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+      const auto left_value = type_cast<int32_t>((*chunk.get_segment(ColumnID{0}))[chunk_offset]);
+      const auto right_value = (*chunk.get_segment(ColumnID{2}))[chunk_offset];
+      if (left_value == 3 || left_value == 5) {
+        EXPECT_TRUE(variant_is_null(right_value));
+        EXPECT_TRUE(variant_is_null((*chunk.get_segment(ColumnID{3}))[chunk_offset]));
+        ++null_count;
+      } else {
+        EXPECT_EQ(type_cast<int32_t>(right_value), left_value);
+      }
+    }
+  }
+  EXPECT_EQ(null_count, 2);
+
+  // NULLs never match in a subsequent scan
+  auto scan = std::make_shared<TableScan>(join, ColumnID{2}, ScanType::OpNotEquals, 2);
+  scan->execute();
+  EXPECT_TABLE_EQ(scan->get_output(), _create_table({{"a", "int"}, {"b", "string"}, {"c", "int"}, {"d", "float"}},
+                                                    {{1, "one", 1, 1.5f}}));
+}
+
+TEST_F(OperatorsJoinHashTest, SemiJoin) {
+  auto join = std::make_shared<JoinHash>(_left, _right, JoinMode::Semi, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(),
+                  _create_table({{"a", "int"}, {"b", "string"}}, {{1, "one"}, {2, "two"}, {2, "zwei"}}), true);
+}
+
+TEST_F(OperatorsJoinHashTest, StringJoinColumns) {
+  auto right_table = std::make_shared<Table>(2);
+  right_table->add_column("name", "string");
+  right_table->append({"two"});
+  right_table->append({"four"});
+  right_table->append({"one"});
+  right_table->compress_chunk(ChunkID{0});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  auto join = std::make_shared<JoinHash>(_left, right, JoinMode::Inner, std::make_pair(ColumnID{1}, ColumnID{0}));
+  join->execute();
+  EXPECT_TABLE_EQ(join->get_output(), _create_table({{"a", "int"}, {"b", "string"}, {"name", "string"}},
+                                                    {{1, "one", "one"}, {2, "two", "two"}}));
+}
+
+TEST_F(OperatorsJoinHashTest, EmptyOutput) {
+  auto scan = std::make_shared<TableScan>(_right, ColumnID{0}, ScanType::OpGreaterThan, 10);
+  scan->execute();
+  auto join = std::make_shared<JoinHash>(_left, scan, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), 0u);
+  EXPECT_EQ(join->get_output()->get_chunk(ChunkID{0}).column_count(), 4u);
+}
+
+TEST_F(OperatorsJoinHashTest, RadixPartitionedJoin) {
+  // Enough distinct values to fill many partitions, some of them without join partners
+  auto left_table = std::make_shared<Table>(100);
+  left_table->add_column("a", "int");
+  left_table->add_column("b", "string");
+  for (int32_t i = 0; i < 1000; ++i) {
+    left_table->append({i % 300, std::to_string(i % 250)});
+  }
+  left_table->compress_chunk(ChunkID{1});
+  auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+
+  auto right_table = std::make_shared<Table>(70);
+  right_table->add_column("c", "int");
+  right_table->add_column("d", "string");
+  for (int32_t i = 0; i < 500; ++i) {
+    right_table->append({i % 400, std::to_string(i % 200)});
+  }
+  right_table->compress_chunk(ChunkID{0}, EncodingType::RunLength);
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // The right columns of a left join contain NULLs, which never match but are part of the output of left joins
+  auto left_with_nulls =
+      std::make_shared<JoinHash>(left, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}), 0);
+  left_with_nulls->execute();
+
+  const auto inputs = std::vector<std::pair<std::shared_ptr<const AbstractOperator>, std::pair<ColumnID, ColumnID>>>{
+      {left, {ColumnID{0}, ColumnID{0}}},
+      {left, {ColumnID{1}, ColumnID{1}}},
+      {left_with_nulls, {ColumnID{2}, ColumnID{0}}}};
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi}) {
+    for (const auto& [left_input, column_ids] : inputs) {
+      auto unpartitioned_join = std::make_shared<JoinHash>(left_input, right, mode, column_ids, 0);
+      unpartitioned_join->execute();
+
+      // Ten radix bits take two partitioning passes
+      for (const auto radix_bits : {1, 5, 10}) {
+        auto join = std::make_shared<JoinHash>(left_input, right, mode, column_ids, radix_bits);
+        join->execute();
+        EXPECT_TABLE_EQ(join->get_output(), unpartitioned_join->get_output());
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, RadixPartitionedJoinOnManyWorkers) {
+  // The partitioning passes, the builds, and the probes of many chunks and partitions run concurrently here
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(8));
+
+  // Every key of the left input has exactly one join partner in the right input, which holds the keys in another order
+  const auto row_count = int32_t{20'000};
+  auto left_table = std::make_shared<Table>(500);
+  left_table->add_column("a", "int");
+  auto right_table = std::make_shared<Table>(700);
+  right_table->add_column("b", "int");
+  for (int32_t i = 0; i < row_count; ++i) {
+    left_table->append({i});
+    right_table->append({(i * 7) % row_count});
+  }
+  auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  for (const auto radix_bits : {0, 6, 10}) {
+    auto join = std::make_shared<JoinHash>(left, right, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                           radix_bits);
+    join->execute();
+    const auto output = join->get_output();
+    ASSERT_EQ(output->row_count(), static_cast<uint64_t>(row_count));
+
+    for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto& chunk = output->get_chunk(chunk_id);
+      const auto left_segment = chunk.get_segment(ColumnID{0});
+      const auto right_segment = chunk.get_segment(ColumnID{1});
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk.size(); ++chunk_offset) {
+        ASSERT_EQ((*left_segment)[chunk_offset], (*right_segment)[chunk_offset]);
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, DefaultRadixBits) {
+  EXPECT_EQ(JoinHash::default_radix_bits(0), 0u);
+  EXPECT_EQ(JoinHash::default_radix_bits(JoinHash::JOIN_HASH_PARTITION_ROW_COUNT), 0u);
+  EXPECT_EQ(JoinHash::default_radix_bits(JoinHash::JOIN_HASH_PARTITION_ROW_COUNT * 4), 2u);
+  EXPECT_EQ(JoinHash::default_radix_bits(JoinHash::JOIN_HASH_PARTITION_ROW_COUNT * 4 + 1), 3u);
+  EXPECT_EQ(JoinHash::default_radix_bits(size_t{1} << 40), JoinHash::MAX_RADIX_BITS);
+
+  EXPECT_THROW(JoinHash(_left, _right, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}), 40), std::exception);
+}
+
+TEST_F(OperatorsJoinHashTest, RequiresSameColumnTypes) {
+  auto join = std::make_shared<JoinHash>(_left, _right, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{1}));
+  EXPECT_THROW(join->execute(), std::exception);
+}
+
+}  // namespace opossum
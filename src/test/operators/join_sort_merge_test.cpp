@@ -0,0 +1,206 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsJoinSortMergeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Unsorted chunks with duplicates, in different encodings
+    auto left_table = std::make_shared<Table>(4);
+    left_table->add_column("a", "int");
+    left_table->add_column("b", "string");
+    for (const auto value : {5, 3, 8, 3, 1, 9, 6, 3, 7, 2, 4, 0, 10, 6}) {
+      left_table->append({value, "v" + std::to_string(value)});
+    }
+    left_table->compress_chunk(ChunkID{0});
+    left_table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    left_table->compress_chunk(ChunkID{2}, EncodingType::Dictionary, AttributeVectorType::BitPacked);
+    _left = std::make_shared<TableWrapper>(left_table);
+    _left->execute();
+
+    auto right_table = std::make_shared<Table>(3);
+    right_table->add_column("c", "int");
+    right_table->add_column("d", "string");
+    for (const auto value : {6, 3, 12, 3, 0, 6, 4}) {
+      right_table->append({value, "v" + std::to_string(value)});
+    }
+    right_table->compress_chunk(ChunkID{1});
+    _right = std::make_shared<TableWrapper>(right_table);
+    _right->execute();
+  }
+
+  // Joins the inputs with nested loops, for inner and semi joins only, as tables cannot be appended NULLs
+  std::shared_ptr<Table> _nested_loop_join(const std::shared_ptr<const AbstractOperator>& left,
+                                           const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                                           const std::pair<ColumnID, ColumnID>& column_ids, const ScanType scan_type) {
+    const auto left_table = left->get_output();
+    const auto right_table = right->get_output();
+    const auto left_rows = _rows(*left_table);
+    const auto right_rows = _rows(*right_table);
+
+    auto table = std::make_shared<Table>();
+    for (ColumnID column_id{0}; column_id < left_table->column_count(); ++column_id) {
+      table->add_column(left_table->column_name(column_id), left_table->column_type(column_id));
+    }
+    if (mode != JoinMode::Semi) {
+      for (ColumnID column_id{0}; column_id < right_table->column_count(); ++column_id) {
+        table->add_column(right_table->column_name(column_id), right_table->column_type(column_id));
+      }
+    }
+
+    for (const auto& left_row : left_rows) {
+      for (const auto& right_row : right_rows) {
+        const auto& left_value = left_row[column_ids.first];
+        const auto& right_value = right_row[column_ids.second];
+        if (variant_is_null(left_value) || variant_is_null(right_value) ||
+            !_compare(scan_type, left_value, right_value)) {
+          continue;
+        }
+
+        if (mode == JoinMode::Semi) {
+          table->append(left_row);
+          break;
+        }
+        auto row = left_row;
+        row.insert(row.end(), right_row.cbegin(), right_row.cend());
+        table->append(row);
+      }
+    }
+    return table;
+  }
+
+  static std::vector<std::vector<AllTypeVariant>> _rows(const Table& table) {
+    std::vector<std::vector<AllTypeVariant>> rows;
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& chunk = table.get_chunk(chunk_id);
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+        std::vector<AllTypeVariant> row;
+        for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+          row.emplace_back((*chunk.get_segment(column_id))[chunk_offset]);
+        }
+        rows.emplace_back(std::move(row));
+      }
+    }
+    return rows;
+  }
+
+  // NullValue only defines == and <, so the other comparisons are expressed with these
+  static bool _compare(const ScanType scan_type, const AllTypeVariant& left, const AllTypeVariant& right) {
+    switch (scan_type) {
+      case ScanType::OpEquals:
+        return left == right;
+      case ScanType::OpNotEquals:
+        return !(left == right);
+      case ScanType::OpLessThan:
+        return left < right;
+      case ScanType::OpLessThanEquals:
+        return !(right < left);
+      case ScanType::OpGreaterThan:
+        return right < left;
+      case ScanType::OpGreaterThanEquals:
+        return !(left < right);
+    }
+    return false;
+  }
+
+  const std::vector<ScanType> _scan_types{ScanType::OpEquals,         ScanType::OpNotEquals,
+                                          ScanType::OpLessThan,       ScanType::OpLessThanEquals,
+                                          ScanType::OpGreaterThan,    ScanType::OpGreaterThanEquals};
+
+  std::shared_ptr<TableWrapper> _left;
+  std::shared_ptr<TableWrapper> _right;
+};
+
+TEST_F(OperatorsJoinSortMergeTest, InnerAndSemiJoins) {
+  for (const auto mode : {JoinMode::Inner, JoinMode::Semi}) {
+    for (const auto scan_type : _scan_types) {
+      for (const auto& column_ids :
+           {std::make_pair(ColumnID{0}, ColumnID{0}), std::make_pair(ColumnID{1}, ColumnID{1})}) {
+        auto join = std::make_shared<JoinSortMerge>(_left, _right, mode, column_ids, scan_type);
+        join->execute();
+        EXPECT_TABLE_EQ(join->get_output(), _nested_loop_join(_left, _right, mode, column_ids, scan_type));
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsJoinSortMergeTest, LeftJoins) {
+  // Rows without join partner are the left rows that are not part of the semi join
+  for (const auto scan_type : _scan_types) {
+    auto join = std::make_shared<JoinSortMerge>(_left, _right, JoinMode::Left,
+                                                std::make_pair(ColumnID{0}, ColumnID{0}), scan_type);
+    join->execute();
+
+    const auto inner_rows =
+        _nested_loop_join(_left, _right, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{0}), scan_type);
+    const auto semi_rows =
+        _nested_loop_join(_left, _right, JoinMode::Semi, std::make_pair(ColumnID{0}, ColumnID{0}), scan_type);
+    EXPECT_EQ(join->get_output()->row_count(),
+              inner_rows->row_count() + _left->get_output()->row_count() - semi_rows->row_count());
+  }
+
+  // Equi joins give the same result as JoinHash
+  auto join = std::make_shared<JoinSortMerge>(_left, _right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}),
+                                              ScanType::OpEquals);
+  join->execute();
+  auto hash_join = std::make_shared<JoinHash>(_left, _right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  hash_join->execute();
+  EXPECT_TABLE_EQ(join->get_output(), hash_join->get_output());
+}
+
+TEST_F(OperatorsJoinSortMergeTest, ReferenceInputsWithNulls) {
+  // The right columns of a left join contain NULLs, which never match but are part of the output of left joins
+  auto scan = std::make_shared<TableScan>(_left, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  scan->execute();
+  auto input_with_nulls =
+      std::make_shared<JoinHash>(scan, _right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  input_with_nulls->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi}) {
+    auto join = std::make_shared<JoinSortMerge>(input_with_nulls, _right, mode,
+                                                std::make_pair(ColumnID{2}, ColumnID{0}), ScanType::OpEquals);
+    join->execute();
+    auto hash_join =
+        std::make_shared<JoinHash>(input_with_nulls, _right, mode, std::make_pair(ColumnID{2}, ColumnID{0}));
+    hash_join->execute();
+    EXPECT_TABLE_EQ(join->get_output(), hash_join->get_output());
+  }
+
+  auto range_join = std::make_shared<JoinSortMerge>(input_with_nulls, scan, JoinMode::Inner,
+                                                    std::make_pair(ColumnID{2}, ColumnID{0}), ScanType::OpLessThan);
+  range_join->execute();
+  EXPECT_TABLE_EQ(range_join->get_output(),
+                  _nested_loop_join(input_with_nulls, scan, JoinMode::Inner, std::make_pair(ColumnID{2}, ColumnID{0}),
+                                    ScanType::OpLessThan));
+}
+
+TEST_F(OperatorsJoinSortMergeTest, EmptyOutput) {
+  auto scan = std::make_shared<TableScan>(_left, ColumnID{0}, ScanType::OpLessThan, 0);
+  scan->execute();
+  auto empty_join = std::make_shared<JoinSortMerge>(scan, _right, JoinMode::Inner,
+                                                    std::make_pair(ColumnID{0}, ColumnID{0}), ScanType::OpGreaterThan);
+  empty_join->execute();
+  EXPECT_EQ(empty_join->get_output()->row_count(), 0u);
+  EXPECT_EQ(empty_join->get_output()->get_chunk(ChunkID{0}).column_count(), 4u);
+}
+
+TEST_F(OperatorsJoinSortMergeTest, RequiresSameColumnTypes) {
+  auto join = std::make_shared<JoinSortMerge>(_left, _right, JoinMode::Inner, std::make_pair(ColumnID{0}, ColumnID{1}),
+                                              ScanType::OpLessThan);
+  EXPECT_THROW(join->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Fixture of the tests of the scans that evaluate several predicates at once, e.g., ConjunctiveTableScan and
+// DisjunctiveTableScan. Its table covers all encodings of the chunks that these scans treat differently.
+class MultiPredicateTableScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks of 1000 rows with different encodings, the last one uncompressed
+    auto table = std::make_shared<Table>(1000);
+    table->add_column("a", "int");
+    table->add_column("b", "float");
+    table->add_column("c", "string");
+    for (int32_t i = 0; i < _row_count; ++i) {
+      table->append({_a(i), _b(i), _c(i)});
+    }
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    table->compress_chunk(ChunkID{2}, EncodingType::Dictionary, AttributeVectorType::BitPacked);
+    table->compress_chunk(ChunkID{3}, EncodingType::Dictionary, AttributeVectorType::BitPacked);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  static int32_t _a(const int32_t i) { return (i * 7) % 250; }
+  static float _b(const int32_t i) { return static_cast<float>(i % 100) / 2; }
+  static std::string _c(const int32_t i) { return std::to_string(i % 13); }
+
+  // Returns the rows of the input table for which the predicate holds, in their order in the input table
+  std::shared_ptr<Table> _expected_table(const std::function<bool(int32_t, float, const std::string&)>& predicate) {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", "int");
+    table->add_column("b", "float");
+    table->add_column("c", "string");
+    for (int32_t i = 0; i < _row_count; ++i) {
+      if (predicate(_a(i), _b(i), _c(i))) table->append({_a(i), _b(i), _c(i)});
+    }
+    return table;
+  }
+
+  static constexpr int32_t _row_count = 4500;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+}  // namespace opossum
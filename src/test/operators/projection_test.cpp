@@ -0,0 +1,176 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/arithmetic_expression.hpp"
+#include "expression/case_expression.hpp"
+#include "expression/column_expression.hpp"
+#include "expression/comparison_expression.hpp"
+#include "expression/value_expression.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table = std::make_shared<Table>(2);
+    table->add_column("name", "string");
+    table->add_column("price", "double");
+    table->add_column("discount", "double");
+    table->add_column("quantity", "int");
+    table->append({"apple", 2.0, 0.5, 3});
+    table->append({"pear", 4.0, 0.25, 1});
+    table->append({"plum", 1.0, 0.0, 10});
+    table->compress_chunk(ChunkID{0});
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+
+    _name = std::make_shared<ColumnExpression>(ColumnID{0}, "string", "name");
+    _quantity = std::make_shared<ColumnExpression>(ColumnID{3}, "int", "quantity");
+
+    // price * (1 - discount)
+    _discounted_price = std::make_shared<ArithmeticExpression>(
+        ArithmeticOperator::Multiplication, std::make_shared<ColumnExpression>(ColumnID{1}, "double", "price"),
+        std::make_shared<ArithmeticExpression>(ArithmeticOperator::Subtraction, std::make_shared<ValueExpression>(1),
+                                               std::make_shared<ColumnExpression>(ColumnID{2}, "double", "discount")));
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<AbstractExpression> _name;
+  std::shared_ptr<AbstractExpression> _quantity;
+  std::shared_ptr<AbstractExpression> _discounted_price;
+};
+
+TEST_F(OperatorsProjectionTest, ComputedColumns) {
+  const auto size = std::make_shared<CaseExpression>(
+      std::make_shared<ComparisonExpression>(ScanType::OpGreaterThanEquals, _quantity,
+                                             std::make_shared<ValueExpression>(3)),
+      std::make_shared<ValueExpression>("many"), std::make_shared<ValueExpression>("few"));
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper, std::vector<std::shared_ptr<AbstractExpression>>{_name, _discounted_price, size});
+  projection->execute();
+
+  auto expected = std::make_shared<Table>();
+  expected->add_column("name", "string");
+  expected->add_column("price * (1 - discount)", "double");
+  expected->add_column("CASE WHEN quantity >= 3 THEN 'many' ELSE 'few' END", "string");
+  expected->append({"apple", 1.0, "many"});
+  expected->append({"pear", 3.0, "few"});
+  expected->append({"plum", 1.0, "many"});
+  EXPECT_TABLE_EQ(projection->get_output(), expected, true);
+}
+
+TEST_F(OperatorsProjectionTest, ForwardsColumns) {
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper, std::vector<std::shared_ptr<AbstractExpression>>{_quantity, _name, _discounted_price});
+  projection->execute();
+
+  // The segments of the input columns are forwarded instead of being copied
+  const auto output = projection->get_output();
+  EXPECT_EQ(output->column_names(), std::vector<std::string>({"quantity", "name", "price * (1 - discount)"}));
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& input_chunk = _table_wrapper->get_output()->get_chunk(chunk_id);
+    const auto& output_chunk = output->get_chunk(chunk_id);
+    EXPECT_EQ(output_chunk.get_segment(ColumnID{0}), input_chunk.get_segment(ColumnID{3}));
+    EXPECT_EQ(output_chunk.get_segment(ColumnID{1}), input_chunk.get_segment(ColumnID{0}));
+  }
+
+  EXPECT_THROW(std::make_shared<Projection>(_table_wrapper, std::vector<std::shared_ptr<AbstractExpression>>{
+                                                                std::make_shared<ColumnExpression>(
+                                                                    ColumnID{3}, "long", "quantity")})
+                   ->execute(),
+               std::exception);
+}
+
+TEST_F(OperatorsProjectionTest, ReferenceSegmentInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{3}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+  auto projection = std::make_shared<Projection>(
+      scan, std::vector<std::shared_ptr<AbstractExpression>>{_discounted_price, _name});
+  projection->execute();
+
+  // The output only consists of ReferenceSegments, so that it can be scanned again
+  const auto output = projection->get_output();
+  const auto& output_chunk = output->get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<ReferenceSegment>(output_chunk.get_segment(ColumnID{0})));
+  EXPECT_EQ(output_chunk.get_segment(ColumnID{1}), scan->get_output()->get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+
+  auto second_scan = std::make_shared<TableScan>(projection, ColumnID{0}, ScanType::OpLessThan, 1.5);
+  second_scan->execute();
+  auto expected = std::make_shared<Table>();
+  expected->add_column("price * (1 - discount)", "double");
+  expected->add_column("name", "string");
+  expected->append({1.0, "apple"});
+  expected->append({1.0, "plum"});
+  EXPECT_TABLE_EQ(second_scan->get_output(), expected);
+}
+
+TEST_F(OperatorsProjectionTest, DivisionByZero) {
+  // The discount of plum is 0, so its price / discount is NULL
+  const auto price_per_discount = std::make_shared<ArithmeticExpression>(
+      ArithmeticOperator::Division, std::make_shared<ColumnExpression>(ColumnID{1}, "double", "price"),
+      std::make_shared<ColumnExpression>(ColumnID{2}, "double", "discount"));
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper, std::vector<std::shared_ptr<AbstractExpression>>{_name, price_per_discount, _quantity});
+  projection->execute();
+
+  // The output consists of ReferenceSegments, which hold the NULL as NULL_ROW_ID
+  const auto output = projection->get_output();
+  ASSERT_EQ(output->row_count(), 3u);
+  ASSERT_EQ(output->chunk_count(), 2u);
+  const auto& first_chunk = output->get_chunk(ChunkID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<ReferenceSegment>(first_chunk.get_segment(ColumnID{0})));
+  EXPECT_EQ((*first_chunk.get_segment(ColumnID{0}))[1], AllTypeVariant{"pear"});
+  EXPECT_EQ((*first_chunk.get_segment(ColumnID{1}))[0], AllTypeVariant{4.0});
+  EXPECT_EQ((*first_chunk.get_segment(ColumnID{1}))[1], AllTypeVariant{16.0});
+  EXPECT_EQ((*first_chunk.get_segment(ColumnID{2}))[1], AllTypeVariant{1});
+  const auto& second_chunk = output->get_chunk(ChunkID{1});
+  EXPECT_EQ((*second_chunk.get_segment(ColumnID{0}))[0], AllTypeVariant{"plum"});
+  EXPECT_TRUE(variant_is_null((*second_chunk.get_segment(ColumnID{1}))[0]));
+  EXPECT_EQ((*second_chunk.get_segment(ColumnID{2}))[0], AllTypeVariant{10});
+
+  // NULLs never match in a subsequent scan
+  auto scan = std::make_shared<TableScan>(projection, ColumnID{1}, ScanType::OpGreaterThan, 0.0);
+  scan->execute();
+  auto expected = std::make_shared<Table>();
+  expected->add_column("name", "string");
+  expected->add_column("price / discount", "double");
+  expected->add_column("quantity", "int");
+  expected->append({"apple", 4.0, 3});
+  expected->append({"pear", 16.0, 1});
+  EXPECT_TABLE_EQ(scan->get_output(), expected);
+
+  // On ReferenceSegments, the NULLs of the computed columns are kept as well
+  auto input_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{3}, ScanType::OpGreaterThan, 1);
+  input_scan->execute();
+  auto referencing_projection = std::make_shared<Projection>(
+      input_scan, std::vector<std::shared_ptr<AbstractExpression>>{price_per_discount, _name});
+  referencing_projection->execute();
+  const auto referencing_output = referencing_projection->get_output();
+  ASSERT_EQ(referencing_output->row_count(), 2u);
+  const auto& last_chunk = referencing_output->get_chunk(ChunkID{referencing_output->chunk_count() - 1});
+  EXPECT_TRUE(variant_is_null((*last_chunk.get_segment(ColumnID{0}))[last_chunk.size() - 1]));
+  EXPECT_EQ((*last_chunk.get_segment(ColumnID{1}))[last_chunk.size() - 1], AllTypeVariant{"plum"});
+}
+
+TEST_F(OperatorsProjectionTest, EmptyInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{3}, ScanType::OpGreaterThan, 100);
+  scan->execute();
+  auto projection = std::make_shared<Projection>(
+      scan, std::vector<std::shared_ptr<AbstractExpression>>{_name, _discounted_price});
+  projection->execute();
+  EXPECT_EQ(projection->get_output()->row_count(), 0u);
+  EXPECT_EQ(projection->get_output()->get_chunk(ChunkID{0}).column_count(), 2u);
+}
+
+}  // namespace opossum
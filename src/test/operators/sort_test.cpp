@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsSortTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Chunks of three rows, with different encodings
+    auto table = std::make_shared<Table>(3);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "float");
+    table->append({3, "c", 1.5f});
+    table->append({1, "b", 2.5f});
+    table->append({2, "a", 3.5f});
+    table->append({1, "a", 4.5f});
+    table->append({3, "b", 5.5f});
+    table->append({2, "c", 6.5f});
+    table->append({1, "b", 7.5f});
+    table->append({2, "a", 8.5f});
+    table->compress_chunk(ChunkID{0});
+    table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _expected_table(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "float");
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsSortTest, SingleColumn) {
+  // Rows with equal values keep their order
+  auto ascending = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}});
+  ascending->execute();
+  EXPECT_TABLE_EQ(ascending->get_output(),
+                  _expected_table({{1, "b", 2.5f},
+                                   {1, "a", 4.5f},
+                                   {1, "b", 7.5f},
+                                   {2, "a", 3.5f},
+                                   {2, "c", 6.5f},
+                                   {2, "a", 8.5f},
+                                   {3, "c", 1.5f},
+                                   {3, "b", 5.5f}}),
+                  true);
+
+  auto descending = std::make_shared<Sort>(
+      _table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}, OrderByMode::Descending}});
+  descending->execute();
+  EXPECT_TABLE_EQ(descending->get_output(),
+                  _expected_table({{3, "c", 1.5f},
+                                   {2, "c", 6.5f},
+                                   {1, "b", 2.5f},
+                                   {3, "b", 5.5f},
+                                   {1, "b", 7.5f},
+                                   {2, "a", 3.5f},
+                                   {1, "a", 4.5f},
+                                   {2, "a", 8.5f}}),
+                  true);
+}
+
+TEST_F(OperatorsSortTest, MultipleColumns) {
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{1}}, {ColumnID{0}, OrderByMode::Descending}});
+  sort->execute();
+  EXPECT_TABLE_EQ(sort->get_output(),
+                  _expected_table({{2, "a", 3.5f},
+                                   {2, "a", 8.5f},
+                                   {1, "a", 4.5f},
+                                   {3, "b", 5.5f},
+                                   {1, "b", 2.5f},
+                                   {1, "b", 7.5f},
+                                   {3, "c", 1.5f},
+                                   {2, "c", 6.5f}}),
+                  true);
+}
+
+TEST_F(OperatorsSortTest, OutputReferencesInputTable) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  scan->execute();
+  auto sort = std::make_shared<Sort>(scan, std::vector<SortColumnDefinition>{{ColumnID{2}, OrderByMode::Descending}});
+  sort->execute();
+  EXPECT_TABLE_EQ(sort->get_output(),
+                  _expected_table({{2, "a", 8.5f}, {2, "c", 6.5f}, {3, "b", 5.5f}, {2, "a", 3.5f}, {3, "c", 1.5f}}),
+                  true);
+
+  const auto& output_chunk = sort->get_output()->get_chunk(ChunkID{0});
+  const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(output_chunk.get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsSortTest, ManyChunks) {
+  // Enough rows for the merge to split the output into several ranges, with many duplicates across chunks
+  auto table = std::make_shared<Table>(50);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  std::vector<std::pair<int32_t, std::string>> rows;
+  for (int32_t i = 0; i < 1000; ++i) {
+    rows.emplace_back((i * 37) % 101, std::to_string((i * 13) % 17));
+    table->append({rows.back().first, rows.back().second});
+  }
+  for (uint32_t chunk_id = 0; chunk_id < table->chunk_count(); chunk_id += 3) {
+    table->compress_chunk(ChunkID{chunk_id});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper,
+                                     std::vector<SortColumnDefinition>{{ColumnID{1}, OrderByMode::Descending}});
+  sort->execute();
+  EXPECT_GT(sort->get_output()->chunk_count(), 1u);
+
+  std::stable_sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+  auto expected = std::make_shared<Table>();
+  expected->add_column("a", "int");
+  expected->add_column("b", "string");
+  for (const auto& [a, b] : rows) {
+    expected->append({a, b});
+  }
+  EXPECT_TABLE_EQ(sort->get_output(), expected, true);
+}
+
+TEST_F(OperatorsSortTest, NullValues) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  right_table->append({2});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // Only the rows with a = 2 have a join partner, so d is NULL for all others
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    auto sort = std::make_shared<Sort>(join, std::vector<SortColumnDefinition>{{ColumnID{3}, order_by_mode}});
+    sort->execute();
+    const auto output = sort->get_output();
+    ASSERT_EQ(output->row_count(), 8u);
+
+    std::vector<bool> nulls;
+    for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto& chunk = output->get_chunk(chunk_id);
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size(); ++chunk_offset) {
+        nulls.push_back(variant_is_null((*chunk.get_segment(ColumnID{3}))[chunk_offset]));
+      }
+    }
+    // NULLs are smaller than all values
+    auto expected_nulls = std::vector<bool>{true, true, true, true, true, false, false, false};
+    if (order_by_mode == OrderByMode::Descending) std::reverse(expected_nulls.begin(), expected_nulls.end());
+    EXPECT_EQ(nulls, expected_nulls);
+  }
+
+  // NULLs cannot be materialized
+  auto materialized_sort = std::make_shared<Sort>(join, std::vector<SortColumnDefinition>{{ColumnID{3}}}, true);
+  EXPECT_THROW(materialized_sort->execute(), std::exception);
+}
+
+TEST_F(OperatorsSortTest, MaterializedOutput) {
+  auto sort = std::make_shared<Sort>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{2}}}, true);
+  sort->execute();
+  const auto output = sort->get_output();
+  EXPECT_TABLE_EQ(output,
+                  _expected_table({{3, "c", 1.5f},
+                                   {1, "b", 2.5f},
+                                   {2, "a", 3.5f},
+                                   {1, "a", 4.5f},
+                                   {3, "b", 5.5f},
+                                   {2, "c", 6.5f},
+                                   {1, "b", 7.5f},
+                                   {2, "a", 8.5f}}),
+                  true);
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<std::string>>(
+      output->get_chunk(ChunkID{0}).get_segment(ColumnID{1})));
+
+  // An empty input results in an empty output with the same columns
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 5);
+  scan->execute();
+  for (const auto materialize_output : {false, true}) {
+    auto empty_sort =
+        std::make_shared<Sort>(scan, std::vector<SortColumnDefinition>{{ColumnID{0}}}, materialize_output);
+    empty_sort->execute();
+    EXPECT_EQ(empty_sort->get_output()->row_count(), 0u);
+    EXPECT_EQ(empty_sort->get_output()->get_chunk(ChunkID{0}).column_count(), 3u);
+  }
+}
+
+}  // namespace opossum
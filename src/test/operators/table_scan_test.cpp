@@ -238,6 +238,44 @@ TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundBounds) {
   }
 }
 
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnAroundUpperBound) {
+  // scanning for the greatest value of the dictionary
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {124};
+  tests[ScanType::OpLessThan] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThan] = {};
+  tests[ScanType::OpGreaterThanEquals] = {124};
+  tests[ScanType::OpNotEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 24);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnDictColumnValueBetweenDictionaryValues) {
+  // 5 lies between the dictionary values 4 and 6
+
+  std::map<ScanType, std::vector<AllTypeVariant>> tests;
+  tests[ScanType::OpEquals] = {};
+  tests[ScanType::OpLessThan] = {100, 102, 104};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104};
+  tests[ScanType::OpGreaterThan] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpGreaterThanEquals] = {106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+  tests[ScanType::OpNotEquals] = {100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<opossum::TableScan>(_table_wrapper_even_dict, ColumnID{0}, test.first, 5);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+}
+
 TEST_F(OperatorsTableScanTest, ScanWithEmptyInput) {
   auto scan_1 = std::make_shared<opossum::TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 12345);
   scan_1->execute();
@@ -267,4 +305,173 @@ TEST_F(OperatorsTableScanTest, ScanOnWideDictionarySegment) {
   EXPECT_EQ(scan_2->get_output()->row_count(), static_cast<size_t>(37));
 }
 
+TEST_F(OperatorsTableScanTest, ScanOnBitPackedDictColumn) {
+  auto table = std::make_shared<Table>(3000);
+  table->add_column("a", "int");
+  for (int i = 0; i < 3000; ++i) table->append({i % 300});
+  table->compress_chunk(ChunkID{0}, EncodingType::Dictionary, AttributeVectorType::BitPacked);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::map<ScanType, size_t> tests;
+  tests[ScanType::OpEquals] = 10;
+  tests[ScanType::OpNotEquals] = 2990;
+  tests[ScanType::OpLessThan] = 2000;
+  tests[ScanType::OpLessThanEquals] = 2010;
+  tests[ScanType::OpGreaterThan] = 990;
+  tests[ScanType::OpGreaterThanEquals] = 1000;
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 200);
+    scan->execute();
+
+    EXPECT_EQ(scan->get_output()->row_count(), test.second);
+  }
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnRunLengthColumn) {
+  // 100 runs of 30 equal values each
+  auto table = std::make_shared<Table>(3000);
+  table->add_column("a", "int");
+  table->add_column("b", "int");
+  for (int i = 0; i < 3000; ++i) table->append({i / 30, i});
+  table->compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::map<ScanType, size_t> tests;
+  tests[ScanType::OpEquals] = 30;
+  tests[ScanType::OpNotEquals] = 2970;
+  tests[ScanType::OpLessThan] = 600;
+  tests[ScanType::OpLessThanEquals] = 630;
+  tests[ScanType::OpGreaterThan] = 2370;
+  tests[ScanType::OpGreaterThanEquals] = 2400;
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 20);
+    scan->execute();
+
+    EXPECT_EQ(scan->get_output()->row_count(), test.second);
+  }
+
+  // scanning the result of another scan resolves the run-length encoded values through the reference segment
+  auto scan_1 = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpLessThan, 100);
+  scan_1->execute();
+  auto scan_2 = std::make_shared<TableScan>(scan_1, ColumnID{0}, ScanType::OpEquals, 2);
+  scan_2->execute();
+  ASSERT_COLUMN_EQ(scan_2->get_output(), ColumnID{1}, {60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74,
+                                                         75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89});
+}
+
+TEST_F(OperatorsTableScanTest, ScanOnFrameOfReferenceColumn) {
+  // values from -1500 to 1499: the search value lies within the first block and below the minimum of the second one
+  auto table = std::make_shared<Table>(3000);
+  table->add_column("a", "int");
+  table->add_column("b", "long");
+  for (int i = 0; i < 3000; ++i) table->append({i - 1500, int64_t{i} * 1000});
+  table->compress_chunk(ChunkID{0}, EncodingType::FrameOfReference);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::map<ScanType, size_t> tests;
+  tests[ScanType::OpEquals] = 1;
+  tests[ScanType::OpNotEquals] = 2999;
+  tests[ScanType::OpLessThan] = 1520;
+  tests[ScanType::OpLessThanEquals] = 1521;
+  tests[ScanType::OpGreaterThan] = 1479;
+  tests[ScanType::OpGreaterThanEquals] = 1480;
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 20);
+    scan->execute();
+
+    EXPECT_EQ(scan->get_output()->row_count(), test.second);
+  }
+
+  // a search value outside of all blocks
+  auto scan_below = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, -5000);
+  scan_below->execute();
+  EXPECT_EQ(scan_below->get_output()->row_count(), 3000u);
+
+  auto scan_long = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, ScanType::OpLessThanEquals, int64_t{2000});
+  scan_long->execute();
+  ASSERT_COLUMN_EQ(scan_long->get_output(), ColumnID{0}, {-1500, -1499, -1498});
+
+  auto scan_referenced = std::make_shared<TableScan>(scan_long, ColumnID{0}, ScanType::OpNotEquals, -1499);
+  scan_referenced->execute();
+  ASSERT_COLUMN_EQ(scan_referenced->get_output(), ColumnID{0}, {-1500, -1498});
+}
+
+TEST_F(OperatorsTableScanTest, PruneChunksWithStatistics) {
+  // _table_wrapper_even_dict has two compressed chunks with a = [0, 8] and a = [10, 18], the last chunk is uncompressed
+  auto scan_1 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThan, 8);
+  scan_1->execute();
+  EXPECT_EQ(scan_1->pruned_chunk_count(), 1u);
+  ASSERT_COLUMN_EQ(scan_1->get_output(), ColumnID{1}, {110, 112, 114, 116, 118, 120, 122, 124});
+
+  auto scan_2 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpEquals, 30);
+  scan_2->execute();
+  EXPECT_EQ(scan_2->pruned_chunk_count(), 2u);
+  EXPECT_EQ(scan_2->get_output()->row_count(), 0u);
+
+  auto scan_3 = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpNotEquals, 4);
+  scan_3->execute();
+  EXPECT_EQ(scan_3->pruned_chunk_count(), 0u);
+}
+
+TEST_F(OperatorsTableScanTest, OutputKeepsChunkStructure) {
+  // _table_wrapper_even_dict has chunks with a = [0, 8], a = [10, 18] and a = [20, 24]
+  auto scan_all = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThanEquals, 0);
+  scan_all->execute();
+  const auto output = scan_all->get_output();
+  ASSERT_EQ(output->chunk_count(), 3u);
+  EXPECT_EQ(output->get_chunk(ChunkID{0}).size(), 5u);
+  EXPECT_EQ(output->get_chunk(ChunkID{1}).size(), 5u);
+  EXPECT_EQ(output->get_chunk(ChunkID{2}).size(), 3u);
+
+  // Input chunks without matches do not produce output chunks
+  auto scan_middle = std::make_shared<TableScan>(scan_all, ColumnID{0}, ScanType::OpGreaterThan, 12);
+  scan_middle->execute();
+  ASSERT_EQ(scan_middle->get_output()->chunk_count(), 2u);
+  ASSERT_COLUMN_EQ(scan_middle->get_output(), ColumnID{1}, {114, 116, 118, 120, 122, 124});
+
+  // An empty result still has its columns
+  auto scan_none = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpLessThan, 0);
+  scan_none->execute();
+  ASSERT_EQ(scan_none->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(scan_none->get_output()->get_chunk(ChunkID{0}).column_count(), 2u);
+  EXPECT_EQ(scan_none->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsTableScanTest, PerformanceData) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_even_dict, ColumnID{0}, ScanType::OpGreaterThanEquals, 10);
+  EXPECT_EQ(scan->performance_data().output_row_count, 0u);
+  scan->execute();
+
+  const auto& performance_data = scan->performance_data();
+  EXPECT_GT(performance_data.walltime.count(), 0);
+  EXPECT_EQ(performance_data.input_row_count_left, 13u);
+  EXPECT_EQ(performance_data.input_row_count_right, 0u);
+  EXPECT_EQ(performance_data.output_row_count, 8u);
+  EXPECT_EQ(performance_data.output_chunk_count, 2u);
+
+  // Both ReferenceSegments of an output chunk share its PosList, which is only counted once
+  const auto output = scan->get_output();
+  auto expected_memory_usage = sizeof(Table);
+  for (ChunkID chunk_id{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& chunk = output->get_chunk(chunk_id);
+    const auto pos_list = std::static_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{0}))->pos_list();
+    EXPECT_EQ(std::static_pointer_cast<ReferenceSegment>(chunk.get_segment(ColumnID{1}))->pos_list(), pos_list);
+    expected_memory_usage +=
+        sizeof(Chunk) + 2 * sizeof(ReferenceSegment) + sizeof(PosList) + pos_list->capacity() * sizeof(RowID);
+  }
+  EXPECT_EQ(performance_data.output_memory_usage, expected_memory_usage);
+  EXPECT_EQ(output->estimate_memory_usage(), expected_memory_usage);
+  EXPECT_EQ(scan->name(), "TableScan");
+
+  // The TableWrapper passes on an existing table, which it does not allocate
+  EXPECT_EQ(_table_wrapper_even_dict->performance_data().output_row_count, 13u);
+  EXPECT_EQ(_table_wrapper_even_dict->performance_data().output_memory_usage, 0u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,138 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsTopNTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Many duplicates, so that ties have to be resolved across chunks of different encodings
+    auto table = std::make_shared<Table>(20);
+    table->add_column("a", "int");
+    table->add_column("b", "string");
+    table->add_column("c", "double");
+    for (int32_t i = 0; i < 200; ++i) {
+      table->append({(i * 7) % 13, std::to_string((i * 11) % 9), static_cast<double>(i % 5)});
+    }
+    for (ChunkID chunk_id{0}; chunk_id < ChunkID{6}; ++chunk_id) {
+      table->compress_chunk(chunk_id);
+    }
+    table->compress_chunk(ChunkID{6}, EncodingType::RunLength);
+    _table_wrapper = std::make_shared<TableWrapper>(table);
+    _table_wrapper->execute();
+  }
+
+  // The first n rows of the output of Sort
+  std::shared_ptr<Table> _expected_table(const std::shared_ptr<const AbstractOperator>& in,
+                                         const std::vector<SortColumnDefinition>& sort_definitions, const size_t n) {
+    auto sort = std::make_shared<Sort>(in, sort_definitions);
+    sort->execute();
+    const auto sorted_table = sort->get_output();
+
+    auto table = std::make_shared<Table>();
+    for (ColumnID column_id{0}; column_id < sorted_table->column_count(); ++column_id) {
+      table->add_column(sorted_table->column_name(column_id), sorted_table->column_type(column_id));
+    }
+    for (ChunkID chunk_id{0}; chunk_id < sorted_table->chunk_count(); ++chunk_id) {
+      const auto& chunk = sorted_table->get_chunk(chunk_id);
+      for (ChunkOffset chunk_offset = 0; chunk_offset < chunk.size() && table->row_count() < n; ++chunk_offset) {
+        std::vector<AllTypeVariant> row;
+        for (ColumnID column_id{0}; column_id < chunk.column_count(); ++column_id) {
+          row.emplace_back((*chunk.get_segment(column_id))[chunk_offset]);
+        }
+        table->append(row);
+      }
+    }
+    return table;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopNTest, MatchesSort) {
+  const auto sort_definitions = std::vector<std::vector<SortColumnDefinition>>{
+      {{ColumnID{0}}},
+      {{ColumnID{0}, OrderByMode::Descending}},
+      {{ColumnID{1}}, {ColumnID{2}, OrderByMode::Descending}},
+      {{ColumnID{1}, OrderByMode::Descending}, {ColumnID{0}}},
+      {{ColumnID{2}}, {ColumnID{1}}}};
+  // Some n are smaller than a single value's rows in a chunk, some are larger than a chunk or the whole table
+  for (const auto& definitions : sort_definitions) {
+    for (const auto n : {size_t{1}, size_t{2}, size_t{10}, size_t{25}, size_t{100}, size_t{500}}) {
+      auto top_n = std::make_shared<TopN>(_table_wrapper, definitions, n);
+      top_n->execute();
+      EXPECT_TABLE_EQ(top_n->get_output(), _expected_table(_table_wrapper, definitions, n), true);
+    }
+  }
+}
+
+TEST_F(OperatorsTopNTest, OutputReferencesInputTable) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 4);
+  scan->execute();
+  const auto definitions = std::vector<SortColumnDefinition>{{ColumnID{1}}, {ColumnID{0}}};
+  auto top_n = std::make_shared<TopN>(scan, definitions, 30);
+  top_n->execute();
+  EXPECT_TABLE_EQ(top_n->get_output(), _expected_table(scan, definitions, 30), true);
+
+  const auto& output_chunk = top_n->get_output()->get_chunk(ChunkID{0});
+  const auto segment = std::dynamic_pointer_cast<ReferenceSegment>(output_chunk.get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table_wrapper->get_output());
+}
+
+TEST_F(OperatorsTopNTest, NullValues) {
+  auto right_table = std::make_shared<Table>();
+  right_table->add_column("d", "int");
+  right_table->append({3});
+  right_table->append({5});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  // Most rows have no join partner, so d is NULL for them
+  auto join =
+      std::make_shared<JoinHash>(_table_wrapper, right, JoinMode::Left, std::make_pair(ColumnID{0}, ColumnID{0}));
+  join->execute();
+
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    const auto definitions = std::vector<SortColumnDefinition>{{ColumnID{3}, order_by_mode}, {ColumnID{2}}};
+    auto top_n = std::make_shared<TopN>(join, definitions, 40);
+    top_n->execute();
+    const auto output = top_n->get_output();
+    ASSERT_EQ(output->row_count(), 40u);
+
+    // NULLs are smaller than all values. There are more than 40 of them, but only about 30 other rows.
+    const auto& chunk = output->get_chunk(ChunkID{0});
+    EXPECT_EQ(variant_is_null((*chunk.get_segment(ColumnID{3}))[0]), order_by_mode == OrderByMode::Ascending);
+    EXPECT_TRUE(variant_is_null((*chunk.get_segment(ColumnID{3}))[39]));
+  }
+}
+
+TEST_F(OperatorsTopNTest, EmptyOutput) {
+  auto top_n = std::make_shared<TopN>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}}, 0);
+  top_n->execute();
+  EXPECT_EQ(top_n->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_n->get_output()->get_chunk(ChunkID{0}).column_count(), 3u);
+
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 20);
+  scan->execute();
+  auto empty_top_n = std::make_shared<TopN>(scan, std::vector<SortColumnDefinition>{{ColumnID{0}}}, 10);
+  empty_top_n->execute();
+  EXPECT_EQ(empty_top_n->get_output()->row_count(), 0u);
+  EXPECT_EQ(empty_top_n->get_output()->get_chunk(ChunkID{0}).column_count(), 3u);
+}
+
+}  // namespace opossum
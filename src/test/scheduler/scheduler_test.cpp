@@ -0,0 +1,158 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/task_scheduler.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+// BaseTest sets a scheduler before and finishes it after every test
+class SchedulerTest : public BaseTest {};
+
+TEST_F(SchedulerTest, TasksRunInlineWithoutScheduler) {
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  auto value = 0;
+  auto first = std::make_shared<JobTask>([&]() { value = 1; });
+  auto second = std::make_shared<JobTask>([&]() { value *= 2; });
+  first->set_as_predecessor_of(second);
+
+  // The successor is scheduled first, but only executed once its predecessor is done
+  second->schedule();
+  EXPECT_FALSE(second->is_done());
+  first->schedule();
+  EXPECT_TRUE(first->is_done());
+  EXPECT_TRUE(second->is_done());
+  EXPECT_EQ(value, 2);
+}
+
+TEST_F(SchedulerTest, DependenciesAreRespected) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+
+  // A diamond: top depends on left and right, which both depend on bottom
+  std::vector<int> order;
+  std::mutex order_mutex;
+  const auto make_job = [&](int id) {
+    return std::make_shared<JobTask>([&, id]() {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+      std::lock_guard<std::mutex> lock(order_mutex);
+      order.push_back(id);
+    });
+  };
+  auto bottom = make_job(0);
+  auto left = make_job(1);
+  auto right = make_job(1);
+  auto top = make_job(2);
+  bottom->set_as_predecessor_of(left);
+  bottom->set_as_predecessor_of(right);
+  left->set_as_predecessor_of(top);
+  right->set_as_predecessor_of(top);
+
+  CurrentScheduler::schedule_and_wait_for_tasks({top, right, left, bottom});
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 1, 2}));
+}
+
+TEST_F(SchedulerTest, ManyJobs) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+
+  std::atomic<int> sum{0};
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  for (auto i = 1; i <= 1000; ++i) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, i]() { sum += i; }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  EXPECT_EQ(sum, 500500);
+}
+
+TEST_F(SchedulerTest, NestedJobsDoNotDeadlock) {
+  // Every job waits for jobs of its own, which only works because waiting workers execute other tasks
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(2));
+
+  std::atomic<int> count{0};
+  std::vector<std::shared_ptr<AbstractTask>> outer_jobs;
+  for (auto outer = 0; outer < 8; ++outer) {
+    outer_jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      std::vector<std::shared_ptr<AbstractTask>> inner_jobs;
+      for (auto inner = 0; inner < 8; ++inner) {
+        inner_jobs.emplace_back(std::make_shared<JobTask>([&]() { ++count; }));
+      }
+      CurrentScheduler::schedule_and_wait_for_tasks(inner_jobs);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(outer_jobs);
+  EXPECT_EQ(count, 64);
+}
+
+TEST_F(SchedulerTest, ExceptionsAreRethrown) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(2));
+
+  auto failing_job = std::make_shared<JobTask>([]() { throw std::logic_error("job failed"); });
+  auto other_job = std::make_shared<JobTask>([]() {});
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks({failing_job, other_job}), std::logic_error);
+  EXPECT_TRUE(other_job->is_done());
+
+  EXPECT_THROW(failing_job->schedule(), std::exception);
+}
+
+TEST_F(SchedulerTest, SuccessorsOfFailedTasksAreNotExecuted) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(2));
+
+  auto successor_was_executed = false;
+  auto failing_job = std::make_shared<JobTask>([]() { throw std::logic_error("job failed"); });
+  auto successor = std::make_shared<JobTask>([&]() { successor_was_executed = true; });
+  auto indirect_successor = std::make_shared<JobTask>([&]() { successor_was_executed = true; });
+  failing_job->set_as_predecessor_of(successor);
+  successor->set_as_predecessor_of(indirect_successor);
+
+  // The successors are done without being executed and pass on the original exception
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks({indirect_successor, successor, failing_job}),
+               std::logic_error);
+  EXPECT_TRUE(indirect_successor->is_done());
+  EXPECT_FALSE(successor_was_executed);
+  EXPECT_THROW(CurrentScheduler::wait_for_tasks({indirect_successor}), std::logic_error);
+}
+
+TEST_F(SchedulerTest, FailingInputOperator) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(2));
+
+  // The scan would read the missing output of the failed GetTable if it was executed
+  auto get_table = std::make_shared<GetTable>("table_that_does_not_exist");
+  auto scan = std::make_shared<TableScan>(get_table, ColumnID{0}, ScanType::OpGreaterThan, 200);
+  const auto tasks = OperatorTask::make_tasks_from_operator(scan);
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks(tasks), std::out_of_range);
+  EXPECT_TRUE(tasks.back()->is_done());
+}
+
+TEST_F(SchedulerTest, OperatorTasks) {
+  CurrentScheduler::set(std::make_shared<TaskScheduler>(4));
+
+  auto table = load_table("src/test/tables/int_float.tbl", 1);
+  table->compress_chunks({ChunkID{0}, ChunkID{1}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  auto scan_a = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 200);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, ScanType::OpLessThan, 458.0f);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(scan_b);
+  ASSERT_EQ(tasks.size(), 3u);
+  EXPECT_EQ(std::static_pointer_cast<OperatorTask>(tasks.back())->get_operator(), scan_b);
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  EXPECT_TABLE_EQ(scan_b->get_output(), load_table("src/test/tables/int_float_filtered.tbl", 1));
+}
+
+}  // namespace opossum
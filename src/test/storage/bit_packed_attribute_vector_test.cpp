@@ -0,0 +1,68 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/bit_packed_attribute_vector.hpp"
+
+class StorageBitPackedAttributeVectorTest : public ::testing::Test {};
+
+TEST_F(StorageBitPackedAttributeVectorTest, SetGet) {
+  opossum::BitPackedAttributeVector bit_packed_vector(9, 100);
+
+  for (size_t index = 0; index < 100; ++index) {
+    bit_packed_vector.set(index, opossum::ValueID{static_cast<uint32_t>((index * 37) % 512)});
+  }
+
+  for (size_t index = 0; index < 100; ++index) {
+    EXPECT_EQ(bit_packed_vector.get(index), opossum::ValueID{static_cast<uint32_t>((index * 37) % 512)});
+  }
+
+  // overwriting a value must not affect its neighbours
+  bit_packed_vector.set(50, opossum::ValueID{0});
+  EXPECT_EQ(bit_packed_vector.get(49), opossum::ValueID{(49 * 37) % 512});
+  EXPECT_EQ(bit_packed_vector.get(50), opossum::ValueID{0});
+  EXPECT_EQ(bit_packed_vector.get(51), opossum::ValueID{(51 * 37) % 512});
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, Width) {
+  EXPECT_EQ(opossum::BitPackedAttributeVector(1, 1).width(), 1);
+  EXPECT_EQ(opossum::BitPackedAttributeVector(9, 1).width(), 2);
+  EXPECT_EQ(opossum::BitPackedAttributeVector(17, 1).width(), 3);
+  EXPECT_EQ(opossum::BitPackedAttributeVector(32, 1).width(), 4);
+  EXPECT_EQ(opossum::BitPackedAttributeVector(9, 1).bit_width(), 9);
+  EXPECT_THROW(opossum::BitPackedAttributeVector(33, 1), std::exception);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, MakeBitPackedHelper) {
+  EXPECT_EQ(opossum::bit_width_for_dictionary_size(1), 1);
+  EXPECT_EQ(opossum::bit_width_for_dictionary_size(2), 1);
+  EXPECT_EQ(opossum::bit_width_for_dictionary_size(3), 2);
+  EXPECT_EQ(opossum::bit_width_for_dictionary_size(300), 9);
+  EXPECT_EQ(opossum::bit_width_for_dictionary_size(512), 9);
+  EXPECT_EQ(opossum::bit_width_for_dictionary_size(513), 10);
+  EXPECT_EQ(opossum::bit_width_for_dictionary_size(4294967295), 32);
+
+  const auto bit_packed_vector = opossum::make_bit_packed_attribute_vector(300, 10);
+  EXPECT_EQ(bit_packed_vector->size(), 10u);
+  EXPECT_EQ(bit_packed_vector->width(), 2);
+}
+
+TEST_F(StorageBitPackedAttributeVectorTest, DecodeInto) {
+  for (const uint8_t bit_width : {1, 3, 9, 17, 31, 32}) {
+    const auto max_value = static_cast<uint32_t>((uint64_t{1} << bit_width) - 1);
+    opossum::BitPackedAttributeVector bit_packed_vector(bit_width, 1000);
+    for (size_t index = 0; index < 1000; ++index) {
+      bit_packed_vector.set(index, opossum::ValueID{static_cast<uint32_t>(index * 2654435761u) & max_value});
+    }
+
+    // an unaligned start and an odd length exercise both the vectorized and the scalar part of the decoder
+    std::vector<opossum::ValueID::base_type> decoded(997);
+    bit_packed_vector.decode_into(3, decoded);
+    for (size_t index = 0; index < decoded.size(); ++index) {
+      EXPECT_EQ(decoded[index], bit_packed_vector.get(index + 3));
+    }
+  }
+}
@@ -0,0 +1,110 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/chunk_compression_service.hpp"
+#include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageChunkCompressionServiceTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    t = std::make_shared<Table>(2);
+    t->add_column("col_1", "int");
+    t->add_column("col_2", "string");
+    for (auto i = 0; i < 5; ++i) {
+      t->append({i, std::to_string(i)});
+    }
+  }
+
+  std::shared_ptr<Table> t;
+};
+
+TEST_F(StorageChunkCompressionServiceTest, CompressesFullChunksButNotTheLastChunk) {
+  ChunkCompressionService service;
+  service.add_table(t);
+
+  EXPECT_EQ(service.compress_full_chunks(), 2u);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(t->get_chunk(ChunkID{0}).get_segment(ColumnID{0})),
+            nullptr);
+  EXPECT_NE(
+      std::dynamic_pointer_cast<DictionarySegment<std::string>>(t->get_chunk(ChunkID{1}).get_segment(ColumnID{1})),
+      nullptr);
+  EXPECT_NE(t->get_chunk(ChunkID{1}).get_statistics(ColumnID{0}), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(t->get_chunk(ChunkID{2}).get_segment(ColumnID{0})),
+            nullptr);
+
+  // Nothing changed, so nothing is compressed again
+  EXPECT_EQ(service.compress_full_chunks(), 0u);
+
+  // Chunk 2 is compressed as soon as a new chunk is started
+  t->append({5, "5"});
+  t->append({6, "6"});
+  EXPECT_EQ(service.compress_full_chunks(), 1u);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(t->get_chunk(ChunkID{2}).get_segment(ColumnID{0})),
+            nullptr);
+  EXPECT_EQ(t->get_chunk(ChunkID{2}).get_segment(ColumnID{1})->operator[](1), AllTypeVariant{"5"});
+}
+
+TEST_F(StorageChunkCompressionServiceTest, SkipsCompressedChunks) {
+  t->compress_chunk(ChunkID{0});
+
+  ChunkCompressionService service;
+  service.add_table(t, EncodingType::RunLength);
+  EXPECT_EQ(service.compress_full_chunks(), 1u);
+  EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(t->get_chunk(ChunkID{0}).get_segment(ColumnID{0})),
+            nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(t->get_chunk(ChunkID{1}).get_segment(ColumnID{0})),
+            nullptr);
+}
+
+TEST_F(StorageChunkCompressionServiceTest, RemoveTable) {
+  ChunkCompressionService service;
+  service.add_table(t);
+  service.remove_table(t);
+  EXPECT_EQ(service.compress_full_chunks(), 0u);
+  EXPECT_THROW(service.remove_table(t), std::exception);
+
+  // col_2 is a string column
+  EXPECT_THROW(service.add_table(t, EncodingType::FrameOfReference), std::exception);
+}
+
+TEST_F(StorageChunkCompressionServiceTest, CompressesInBackground) {
+  ChunkCompressionService service{std::chrono::milliseconds{1}};
+  service.add_table(t);
+  service.start();
+  EXPECT_TRUE(service.is_running());
+  EXPECT_THROW(service.start(), std::exception);
+
+  for (auto i = 5; i < 200; ++i) {
+    t->append({i, std::to_string(i)});
+  }
+
+  // Wait until the background thread has caught up with the appended rows
+  const auto last_full_chunk_id = ChunkID{t->chunk_count() - 2};
+  for (auto attempt = 0; attempt < 1000; ++attempt) {
+    if (std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+            t->get_chunk(last_full_chunk_id).get_segment(ColumnID{0}))) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  service.stop();
+  EXPECT_FALSE(service.is_running());
+
+  for (ChunkID chunk_id{0}; chunk_id <= last_full_chunk_id; ++chunk_id) {
+    EXPECT_NE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(t->get_chunk(chunk_id).get_segment(ColumnID{0})),
+              nullptr);
+  }
+  EXPECT_EQ(t->row_count(), 200u);
+  EXPECT_EQ(t->get_chunk(ChunkID{50}).get_segment(ColumnID{0})->operator[](1), AllTypeVariant{101});
+}
+
+}  // namespace opossum
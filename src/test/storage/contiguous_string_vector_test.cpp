@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/contiguous_string_vector.hpp"
+
+class StorageContiguousStringVectorTest : public ::testing::Test {
+ protected:
+  std::vector<std::string> strings{"Alexander", "", "Bill", "Hasso", "Steve"};
+};
+
+TEST_F(StorageContiguousStringVectorTest, Access) {
+  opossum::ContiguousStringVector string_vector(strings.cbegin(), strings.cend());
+
+  EXPECT_EQ(string_vector.size(), 5u);
+  EXPECT_EQ(string_vector.data_size(), 23u);
+  for (size_t index = 0; index < strings.size(); ++index) {
+    EXPECT_EQ(string_vector[index], strings[index]);
+  }
+  EXPECT_EQ(string_vector.front(), "Alexander");
+  EXPECT_EQ(string_vector.back(), "Steve");
+}
+
+TEST_F(StorageContiguousStringVectorTest, Iterators) {
+  opossum::ContiguousStringVector string_vector(strings.cbegin(), strings.cend());
+
+  EXPECT_EQ(std::distance(string_vector.cbegin(), string_vector.cend()), 5);
+  EXPECT_TRUE(std::equal(string_vector.cbegin(), string_vector.cend(), strings.cbegin()));
+
+  auto it = string_vector.cbegin() + 2;
+  EXPECT_EQ(*it, "Bill");
+  EXPECT_EQ(it[1], "Hasso");
+  EXPECT_EQ(*(--it), "");
+}
+
+TEST_F(StorageContiguousStringVectorTest, BinarySearch) {
+  std::sort(strings.begin(), strings.end());
+  opossum::ContiguousStringVector string_vector(strings.cbegin(), strings.cend());
+
+  const auto lower = std::lower_bound(string_vector.cbegin(), string_vector.cend(), std::string{"Bob"});
+  EXPECT_EQ(lower - string_vector.cbegin(), 3);
+  EXPECT_EQ(*lower, "Hasso");
+
+  const auto upper = std::upper_bound(string_vector.cbegin(), string_vector.cend(), std::string{"Steve"});
+  EXPECT_EQ(upper, string_vector.cend());
+}
+
+TEST_F(StorageContiguousStringVectorTest, Empty) {
+  const auto no_strings = std::vector<std::string>{};
+  opossum::ContiguousStringVector string_vector(no_strings.cbegin(), no_strings.cend());
+
+  EXPECT_TRUE(string_vector.empty());
+  EXPECT_EQ(string_vector.cbegin(), string_vector.cend());
+}
@@ -39,6 +39,18 @@ TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
   EXPECT_EQ((*dict)[3], "Steve");
 }
 
+TEST_F(StorageDictionarySegmentTest, AttributeVectorReferencesSortedDictionary) {
+  for (int i = 0; i < 100; ++i) vc_int->append((i * 37) % 10);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("int", vc_int);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int>>(col);
+
+  EXPECT_EQ(dict_col->unique_values_count(), 10u);
+  for (size_t i = 0; i < 100; ++i) {
+    EXPECT_EQ(dict_col->attribute_vector()->get(i), opossum::ValueID((i * 37) % 10));
+    EXPECT_EQ(dict_col->get(i), vc_int->values()[i]);
+  }
+}
+
 TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
   for (int i = 0; i <= 10; i += 2) vc_int->append(i);
   auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("int", vc_int);
@@ -54,6 +66,22 @@ TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
   EXPECT_EQ(dict_col->upper_bound(15), opossum::INVALID_VALUE_ID);
 }
 
+TEST_F(StorageDictionarySegmentTest, LowerUpperBoundString) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("string", vc_str);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<std::string>>(col);
+
+  EXPECT_EQ(dict_col->lower_bound(std::string{"Bill"}), (opossum::ValueID)1);
+  EXPECT_EQ(dict_col->upper_bound(std::string{"Bill"}), (opossum::ValueID)2);
+  EXPECT_EQ(dict_col->lower_bound(std::string{"Hasso"}), (opossum::ValueID)2);
+  EXPECT_EQ(dict_col->upper_bound(std::string{"Zeus"}), opossum::INVALID_VALUE_ID);
+
+  EXPECT_EQ(dict_col->get(1), "Steve");
+  EXPECT_EQ(dict_col->value_by_value_id(opossum::ValueID{2}), "Steve");
+}
+
 TEST_F(StorageDictionarySegmentTest, GetAndBracketOperator) {
   for (int i = 0; i <= 10; i += 2) vc_int->append(i);
   auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("int", vc_int);
@@ -71,3 +99,29 @@ TEST_F(StorageDictionarySegmentTest, Append) {
 
   EXPECT_THROW(col->append(opossum::AllTypeVariant{0}), std::exception);
 }
+
+TEST_F(StorageDictionarySegmentTest, BitPackedAttributeVector) {
+  for (int i = 0; i < 300; ++i) vc_int->append(i % 150);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>(
+      "int", vc_int, opossum::AttributeVectorType::BitPacked);
+  auto dict_col = std::dynamic_pointer_cast<opossum::DictionarySegment<int>>(col);
+
+  // 150 distinct values need 8 bits
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const opossum::BitPackedAttributeVector>(dict_col->attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_EQ(attribute_vector->bit_width(), 8);
+
+  for (int i = 0; i < 300; ++i) {
+    EXPECT_EQ(dict_col->get(i), i % 150);
+  }
+}
+
+TEST_F(StorageDictionarySegmentTest, EstimateMemoryUsage) {
+  for (int i = 0; i < 1000; ++i) vc_int->append(i % 10);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::DictionarySegment>("int", vc_int);
+
+  // 10 distinct values need one byte per row in the attribute vector
+  EXPECT_GE(col->estimate_memory_usage(), 1000u + 10 * sizeof(int));
+  EXPECT_LT(col->estimate_memory_usage(), vc_int->estimate_memory_usage());
+}
@@ -0,0 +1,76 @@
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/storage/base_segment.hpp"
+#include "../../lib/storage/frame_of_reference_segment.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+class StorageFrameOfReferenceSegmentTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<opossum::ValueSegment<int>> vc_int = std::make_shared<opossum::ValueSegment<int>>();
+  std::shared_ptr<opossum::ValueSegment<int64_t>> vc_long = std::make_shared<opossum::ValueSegment<int64_t>>();
+};
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegmentInt) {
+  // two blocks, one starting at -1000 and one at 1000000
+  for (int i = 0; i < 2048; ++i) vc_int->append(-1000 + i % 100);
+  for (int i = 0; i < 100; ++i) vc_int->append(1000000 + i * 3);
+
+  auto for_col = std::make_shared<opossum::FrameOfReferenceSegment<int>>(vc_int);
+
+  EXPECT_EQ(for_col->size(), 2148u);
+  ASSERT_EQ(for_col->block_minima()->size(), 2u);
+  EXPECT_EQ((*for_col->block_minima())[0], -1000);
+  EXPECT_EQ((*for_col->block_minima())[1], 1000000);
+
+  // the largest offset is 297, which requires 9 bits
+  EXPECT_EQ(for_col->offsets()->bit_width(), 9);
+
+  for (int i = 0; i < 2048; ++i) EXPECT_EQ(for_col->get(i), -1000 + i % 100);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(for_col->get(2048 + i), 1000000 + i * 3);
+  EXPECT_EQ((*for_col)[2048 + 99], opossum::AllTypeVariant{1000297});
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, CompressSegmentLong) {
+  const auto base = int64_t{1} << 40;
+  vc_long->append(base + 5);
+  vc_long->append(base);
+  vc_long->append(base + 1);
+
+  auto for_col = std::make_shared<opossum::FrameOfReferenceSegment<int64_t>>(vc_long);
+
+  EXPECT_EQ(for_col->get(0), base + 5);
+  EXPECT_EQ(for_col->get(1), base);
+  EXPECT_EQ(for_col->get(2), base + 1);
+  EXPECT_EQ(for_col->offsets()->bit_width(), 3);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, WidestRange) {
+  // The range of 2^32 - 1 still fits into 32 bits
+  const auto max = int64_t{std::numeric_limits<uint32_t>::max()};
+  vc_long->append(int64_t{0});
+  vc_long->append(max);
+
+  auto for_col = std::make_shared<opossum::FrameOfReferenceSegment<int64_t>>(vc_long);
+
+  EXPECT_EQ(for_col->offsets()->bit_width(), 32);
+  EXPECT_EQ(for_col->get(0), 0);
+  EXPECT_EQ(for_col->get(1), max);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, RangeTooWide) {
+  vc_long->append(int64_t{0});
+  vc_long->append(int64_t{1} << 33);
+
+  EXPECT_THROW(std::make_shared<opossum::FrameOfReferenceSegment<int64_t>>(vc_long), std::exception);
+}
+
+TEST_F(StorageFrameOfReferenceSegmentTest, Append) {
+  vc_int->append(1);
+  auto for_col = std::make_shared<opossum::FrameOfReferenceSegment<int>>(vc_int);
+
+  EXPECT_THROW(for_col->append(opossum::AllTypeVariant{0}), std::exception);
+}
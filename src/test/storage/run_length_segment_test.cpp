@@ -0,0 +1,65 @@
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "../../lib/resolve_type.hpp"
+#include "../../lib/storage/base_segment.hpp"
+#include "../../lib/storage/run_length_segment.hpp"
+#include "../../lib/storage/value_segment.hpp"
+
+class StorageRunLengthSegmentTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<opossum::ValueSegment<int>> vc_int = std::make_shared<opossum::ValueSegment<int>>();
+  std::shared_ptr<opossum::ValueSegment<std::string>> vc_str = std::make_shared<opossum::ValueSegment<std::string>>();
+};
+
+TEST_F(StorageRunLengthSegmentTest, CompressSegmentString) {
+  vc_str->append("Bill");
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  vc_str->append("Alexander");
+  vc_str->append("Alexander");
+  vc_str->append("Bill");
+
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::RunLengthSegment>("string", vc_str);
+  auto rle_col = std::dynamic_pointer_cast<opossum::RunLengthSegment<std::string>>(col);
+
+  EXPECT_EQ(rle_col->size(), 7u);
+  EXPECT_EQ(rle_col->run_count(), 4u);
+
+  const auto& values = *rle_col->values();
+  const auto& end_positions = *rle_col->end_positions();
+  EXPECT_EQ(values[0], "Bill");
+  EXPECT_EQ(values[1], "Steve");
+  EXPECT_EQ(values[2], "Alexander");
+  EXPECT_EQ(values[3], "Bill");
+  EXPECT_EQ(end_positions[0], 1u);
+  EXPECT_EQ(end_positions[1], 2u);
+  EXPECT_EQ(end_positions[2], 5u);
+  EXPECT_EQ(end_positions[3], 6u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, GetAndBracketOperator) {
+  for (int i = 0; i < 10; ++i) vc_int->append(i / 3);
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::RunLengthSegment>("int", vc_int);
+  auto rle_col = std::dynamic_pointer_cast<opossum::RunLengthSegment<int>>(col);
+
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(rle_col->get(i), i / 3);
+    EXPECT_EQ((*rle_col)[i], opossum::AllTypeVariant{i / 3});
+  }
+}
+
+TEST_F(StorageRunLengthSegmentTest, EmptySegment) {
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::RunLengthSegment>("int", vc_int);
+
+  EXPECT_EQ(col->size(), 0u);
+}
+
+TEST_F(StorageRunLengthSegmentTest, Append) {
+  auto col = opossum::make_shared_by_data_type<opossum::BaseSegment, opossum::RunLengthSegment>("int", vc_int);
+
+  EXPECT_THROW(col->append(opossum::AllTypeVariant{0}), std::exception);
+}
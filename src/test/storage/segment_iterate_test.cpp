@@ -0,0 +1,136 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/resolve_type.hpp"
+#include "../lib/storage/reference_segment.hpp"
+#include "../lib/storage/segment_encoding_utils.hpp"
+#include "../lib/storage/segment_iterate.hpp"
+#include "../lib/storage/table.hpp"
+#include "../lib/storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageSegmentIterateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // Runs of equal values and values spanning more than one FrameOfReference block
+    std::vector<int32_t> int_values;
+    std::vector<std::string> string_values;
+    for (int32_t i = 0; i < 5000; ++i) {
+      int_values.push_back(i / 3 + 100);
+      string_values.push_back("value" + std::to_string(i / 7));
+    }
+    int_segment = std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{int_values});
+    string_segment = std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{string_values});
+    expected_int_values = std::move(int_values);
+    expected_string_values = std::move(string_values);
+  }
+
+  template <typename T>
+  std::vector<T> materialize(const BaseSegment& segment) {
+    std::vector<T> values;
+    segment_iterate<T>(segment, [&](const auto& position) {
+      EXPECT_EQ(position.chunk_offset(), values.size());
+      values.emplace_back(position.value());
+    });
+    return values;
+  }
+
+  std::shared_ptr<BaseSegment> int_segment;
+  std::shared_ptr<BaseSegment> string_segment;
+  std::vector<int32_t> expected_int_values;
+  std::vector<std::string> expected_string_values;
+};
+
+TEST_F(StorageSegmentIterateTest, ResolveSegmentType) {
+  const auto dictionary_segment =
+      encode_segment(EncodingType::Dictionary, "int", int_segment, AttributeVectorType::Fitted);
+
+  auto resolved_value_segment = false;
+  resolve_segment_type<int32_t>(*int_segment, [&](const auto& typed_segment) {
+    resolved_value_segment = std::is_same_v<std::decay_t<decltype(typed_segment)>, ValueSegment<int32_t>>;
+  });
+  EXPECT_TRUE(resolved_value_segment);
+
+  auto resolved_dictionary_segment = false;
+  resolve_segment_type<int32_t>(*dictionary_segment, [&](const auto& typed_segment) {
+    resolved_dictionary_segment = std::is_same_v<std::decay_t<decltype(typed_segment)>, DictionarySegment<int32_t>>;
+  });
+  EXPECT_TRUE(resolved_dictionary_segment);
+
+  // The data type has to match
+  EXPECT_THROW(resolve_segment_type<float>(*int_segment, [](const auto&) {}), std::exception);
+}
+
+TEST_F(StorageSegmentIterateTest, IterateEncodedSegments) {
+  EXPECT_EQ(materialize<int32_t>(*int_segment), expected_int_values);
+  EXPECT_EQ(materialize<std::string>(*string_segment), expected_string_values);
+
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FrameOfReference}) {
+    const auto encoded_segment = encode_segment(encoding_type, "int", int_segment, AttributeVectorType::Fitted);
+    EXPECT_EQ(materialize<int32_t>(*encoded_segment), expected_int_values);
+  }
+
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength}) {
+    const auto encoded_segment = encode_segment(encoding_type, "string", string_segment, AttributeVectorType::Fitted);
+    EXPECT_EQ(materialize<std::string>(*encoded_segment), expected_string_values);
+  }
+
+  const auto bit_packed_segment =
+      encode_segment(EncodingType::Dictionary, "string", string_segment, AttributeVectorType::BitPacked);
+  EXPECT_EQ(materialize<std::string>(*bit_packed_segment), expected_string_values);
+}
+
+TEST_F(StorageSegmentIterateTest, IterateReferenceSegment) {
+  // A table with differently encoded chunks, the referenced column is not the first one
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int");
+  table->add_column("b", "string");
+  for (int32_t i = 0; i < 12; ++i) {
+    table->append({i, std::to_string(i)});
+  }
+  table->compress_chunk(ChunkID{0}, EncodingType::Dictionary);
+  table->compress_chunk(ChunkID{1}, EncodingType::RunLength);
+
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{2}, 3}, RowID{ChunkID{0}, 1},
+                                                          RowID{ChunkID{1}, 0}, RowID{ChunkID{0}, 1}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{1}, pos_list};
+  EXPECT_EQ(materialize<std::string>(reference_segment), (std::vector<std::string>{"11", "1", "4", "1"}));
+
+  const auto int_reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  EXPECT_EQ(materialize<int32_t>(int_reference_segment), (std::vector<int32_t>{11, 1, 4, 1}));
+}
+
+TEST_F(StorageSegmentIterateTest, IterateReferenceSegmentRuns) {
+  auto table = std::make_shared<Table>(1000);
+  table->add_column("a", "int");
+  table->append_columns(std::vector<int32_t>{expected_int_values});
+  table->compress_chunk(ChunkID{0}, EncodingType::Dictionary, AttributeVectorType::BitPacked);
+  table->compress_chunk(ChunkID{1}, EncodingType::FrameOfReference);
+  table->compress_chunk(ChunkID{2}, EncodingType::RunLength);
+
+  // Every second row of the first four chunks, in runs of several positions per chunk, and a run in the first chunk
+  // again at the end
+  auto pos_list = std::make_shared<PosList>();
+  std::vector<int32_t> expected_values;
+  for (ChunkID chunk_id{0}; chunk_id < 4; ++chunk_id) {
+    for (ChunkOffset chunk_offset = 0; chunk_offset < 1000; chunk_offset += 2) {
+      pos_list->emplace_back(RowID{chunk_id, chunk_offset});
+      expected_values.push_back(expected_int_values[chunk_id * 1000 + chunk_offset]);
+    }
+  }
+  for (ChunkOffset chunk_offset = 999; chunk_offset > 990; --chunk_offset) {
+    pos_list->emplace_back(RowID{ChunkID{0}, chunk_offset});
+    expected_values.push_back(expected_int_values[chunk_offset]);
+  }
+
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  EXPECT_EQ(materialize<int32_t>(reference_segment), expected_values);
+}
+
+}  // namespace opossum
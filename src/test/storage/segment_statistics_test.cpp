@@ -0,0 +1,40 @@
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "../lib/storage/segment_statistics.hpp"
+
+namespace opossum {
+
+class StorageSegmentStatisticsTest : public BaseTest {
+ protected:
+  SegmentStatistics int_statistics{AllTypeVariant{10}, AllTypeVariant{20}};
+  SegmentStatistics single_value_statistics{AllTypeVariant{std::string{"b"}}, AllTypeVariant{std::string{"b"}}};
+};
+
+TEST_F(StorageSegmentStatisticsTest, CanPrune) {
+  EXPECT_TRUE(can_prune(int_statistics, ScanType::OpEquals, 9));
+  EXPECT_FALSE(can_prune(int_statistics, ScanType::OpEquals, 10));
+  EXPECT_TRUE(can_prune(int_statistics, ScanType::OpEquals, 21));
+
+  EXPECT_FALSE(can_prune(int_statistics, ScanType::OpNotEquals, 15));
+
+  EXPECT_TRUE(can_prune(int_statistics, ScanType::OpLessThan, 10));
+  EXPECT_FALSE(can_prune(int_statistics, ScanType::OpLessThan, 11));
+  EXPECT_TRUE(can_prune(int_statistics, ScanType::OpLessThanEquals, 9));
+  EXPECT_FALSE(can_prune(int_statistics, ScanType::OpLessThanEquals, 10));
+
+  EXPECT_TRUE(can_prune(int_statistics, ScanType::OpGreaterThan, 20));
+  EXPECT_FALSE(can_prune(int_statistics, ScanType::OpGreaterThan, 19));
+  EXPECT_TRUE(can_prune(int_statistics, ScanType::OpGreaterThanEquals, 21));
+  EXPECT_FALSE(can_prune(int_statistics, ScanType::OpGreaterThanEquals, 20));
+}
+
+TEST_F(StorageSegmentStatisticsTest, CanPruneSingleValue) {
+  EXPECT_TRUE(can_prune(single_value_statistics, ScanType::OpNotEquals, std::string{"b"}));
+  EXPECT_FALSE(can_prune(single_value_statistics, ScanType::OpNotEquals, std::string{"c"}));
+  EXPECT_FALSE(can_prune(single_value_statistics, ScanType::OpEquals, std::string{"b"}));
+}
+
+}  // namespace opossum
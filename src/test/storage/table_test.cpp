@@ -10,6 +10,8 @@
 #include "../lib/resolve_type.hpp"
 #include "../lib/storage/table.hpp"
 #include "../lib/storage/dictionary_segment.hpp"
+#include "../lib/storage/run_length_segment.hpp"
+#include "../lib/storage/segment_statistics.hpp"
 
 namespace opossum {
 
@@ -86,4 +88,169 @@ TEST_F(StorageTableTest, CompressChunk) {
     t.get_chunk(ChunkID{0}).get_segment(ColumnID{1})));
 }
 
+TEST_F(StorageTableTest, CompressChunkRunLength) {
+  t.append({4, "Hello,"});
+  t.append({4, "Hello,"});
+  t.append({3, "!"});
+  t.compress_chunk(ChunkID{0}, EncodingType::RunLength);
+
+  EXPECT_EQ(type_cast<int>((*(t.get_chunk(ChunkID{0}).get_segment(ColumnID{0})))[1]), 4);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).size(), 2u);
+  const auto segment =
+      std::dynamic_pointer_cast<RunLengthSegment<std::string>>(t.get_chunk(ChunkID{0}).get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->run_count(), 1u);
+}
+
+TEST_F(StorageTableTest, CompressChunkFrameOfReferenceRequiresIntegers) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+
+  // col_2 is a string column
+  EXPECT_THROW(t.compress_chunk(ChunkID{0}, EncodingType::FrameOfReference), std::exception);
+}
+
+TEST_F(StorageTableTest, CompressChunkComputesStatistics) {
+  t.append({4, "Hello,"});
+  t.append({6, "world"});
+  t.append({3, "!"});
+
+  EXPECT_EQ(t.get_chunk(ChunkID{0}).get_statistics(ColumnID{0}), nullptr);
+
+  t.compress_chunk(ChunkID{0});
+  const auto int_statistics = t.get_chunk(ChunkID{0}).get_statistics(ColumnID{0});
+  ASSERT_NE(int_statistics, nullptr);
+  EXPECT_EQ(int_statistics->min, AllTypeVariant{4});
+  EXPECT_EQ(int_statistics->max, AllTypeVariant{6});
+
+  const auto string_statistics = t.get_chunk(ChunkID{0}).get_statistics(ColumnID{1});
+  ASSERT_NE(string_statistics, nullptr);
+  EXPECT_EQ(string_statistics->min, AllTypeVariant{"Hello,"});
+  EXPECT_EQ(string_statistics->max, AllTypeVariant{"world"});
+
+  t.append({5, "?"});
+  t.compress_chunk(ChunkID{1}, EncodingType::RunLength);
+  const auto run_length_statistics = t.get_chunk(ChunkID{1}).get_statistics(ColumnID{0});
+  ASSERT_NE(run_length_statistics, nullptr);
+  EXPECT_EQ(run_length_statistics->min, AllTypeVariant{3});
+  EXPECT_EQ(run_length_statistics->max, AllTypeVariant{5});
+}
+
+TEST_F(StorageTableTest, CompressChunks) {
+  for (auto i = 0; i < 9; ++i) {
+    t.append({i, std::to_string(i)});
+  }
+  t.compress_chunks({ChunkID{0}, ChunkID{1}, ChunkID{3}});
+
+  for (const auto& chunk_id : {ChunkID{0}, ChunkID{1}, ChunkID{3}}) {
+    EXPECT_TRUE(
+        std::dynamic_pointer_cast<DictionarySegment<int32_t>>(t.get_chunk(chunk_id).get_segment(ColumnID{0})));
+    EXPECT_TRUE(
+        std::dynamic_pointer_cast<DictionarySegment<std::string>>(t.get_chunk(chunk_id).get_segment(ColumnID{1})));
+  }
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<int32_t>>(t.get_chunk(ChunkID{2}).get_segment(ColumnID{0})));
+  EXPECT_EQ(type_cast<std::string>((*t.get_chunk(ChunkID{3}).get_segment(ColumnID{1}))[1]), "7");
+
+  // Compressing a chunk twice is not allowed
+  EXPECT_THROW(t.compress_chunks({ChunkID{2}, ChunkID{3}}), std::exception);
+}
+
+TEST_F(StorageTableTest, AppendColumns) {
+  Table table{3};
+  table.add_column("a", "int");
+  table.add_column("b", "string");
+
+  // two rows fit into the empty first chunk, so the values are moved into its segments
+  auto int_values = std::vector<int32_t>{1, 2};
+  const auto* const int_data = int_values.data();
+  table.append_columns(std::move(int_values), std::vector<std::string>{"a", "b"});
+  EXPECT_EQ(table.chunk_count(), 1u);
+  const auto int_segment =
+      std::dynamic_pointer_cast<ValueSegment<int32_t>>(table.get_chunk(ChunkID{0}).get_segment(ColumnID{0}));
+  ASSERT_TRUE(int_segment);
+  EXPECT_EQ(int_segment->values().data(), int_data);
+
+  // five more rows fill up the first chunk and are split into two further chunks
+  table.append_columns(std::vector<int32_t>{3, 4, 5, 6, 7}, std::vector<std::string>{"c", "d", "e", "f", "g"});
+  EXPECT_EQ(table.row_count(), 7u);
+  EXPECT_EQ(table.chunk_count(), 3u);
+  EXPECT_EQ(table.get_chunk(ChunkID{0}).size(), 3u);
+  EXPECT_EQ(table.get_chunk(ChunkID{1}).size(), 3u);
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).size(), 1u);
+
+  auto expected_table = std::make_shared<Table>(2);
+  expected_table->add_column("a", "int");
+  expected_table->add_column("b", "string");
+  for (int i = 0; i < 7; ++i) expected_table->append({i + 1, std::string(1, static_cast<char>('a' + i))});
+  EXPECT_TABLE_EQ(table, *expected_table, true);
+}
+
+TEST_F(StorageTableTest, AppendColumnsDoesNotShareValues) {
+  Table table{10};
+  table.add_column("a", "int");
+
+  // Rows appended later go into the table's own segment, and the same values can be appended again
+  const auto values = std::vector<int32_t>{1, 2, 3};
+  table.append_columns(std::vector<int32_t>{values});
+  table.append({4});
+  table.append_columns(std::vector<int32_t>{values});
+  EXPECT_EQ(values.size(), 3u);
+
+  Table expected_table{10};
+  expected_table.add_column("a", "int");
+  for (const auto value : {1, 2, 3, 4, 1, 2, 3}) expected_table.append({value});
+  EXPECT_TABLE_EQ(table, expected_table, true);
+}
+
+TEST_F(StorageTableTest, AppendColumnsToColumnDefinitions) {
+  // Only the column definitions exist, so the first chunk does not have segments yet
+  Table table{2};
+  table.add_column_definition("a", "int");
+  table.add_column_definition("b", "string");
+  table.append_columns(std::vector<int32_t>{1, 2, 3, 4, 5}, std::vector<std::string>{"a", "b", "c", "d", "e"});
+  EXPECT_EQ(table.chunk_count(), 3u);
+  EXPECT_EQ(table.get_chunk(ChunkID{2}).size(), 1u);
+
+  Table expected_table{2};
+  expected_table.add_column("a", "int");
+  expected_table.add_column("b", "string");
+  for (int i = 0; i < 5; ++i) expected_table.append({i + 1, std::string(1, static_cast<char>('a' + i))});
+  EXPECT_TABLE_EQ(table, expected_table, true);
+}
+
+TEST_F(StorageTableTest, AppendColumnsChecksTypes) {
+  EXPECT_THROW(t.append_columns(std::vector<int32_t>{1}), std::exception);
+  EXPECT_THROW(t.append_columns(std::vector<float>{1.0f}, std::vector<std::string>{"a"}), std::exception);
+}
+
+TEST_F(StorageTableTest, CreateNewChunk) {
+  t.append({4, "Hello,"});
+  t.create_new_chunk();
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{1}).column_count(), 2u);
+}
+
+TEST_F(StorageTableTest, EmplaceChunk) {
+  // The initial chunk of a table that only has column definitions is replaced
+  Table table;
+  table.add_column_definition("a", "int");
+  Chunk first_chunk;
+  first_chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1, 2}));
+  table.emplace_chunk(first_chunk);
+  EXPECT_EQ(table.chunk_count(), 1u);
+  EXPECT_EQ(table.row_count(), 2u);
+
+  Chunk second_chunk;
+  second_chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{3}));
+  table.emplace_chunk(second_chunk);
+  EXPECT_EQ(table.chunk_count(), 2u);
+
+  // Chunks with segments are never replaced, even if they are empty
+  Chunk third_chunk;
+  third_chunk.add_segment(std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{4}));
+  third_chunk.add_segment(std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"4"}));
+  t.emplace_chunk(third_chunk);
+  EXPECT_EQ(t.chunk_count(), 2u);
+}
+
 }  // namespace opossum
@@ -47,4 +47,26 @@ TEST_F(StorageValueSegmentTest, AddValueOfDifferentType) {
   EXPECT_THROW(double_value_segment.append("Hi"), std::exception);
 }
 
+TEST_F(StorageValueSegmentTest, ConstructAndAppendTypedValues) {
+  std::vector<int> values{1, 2, 3};
+  ValueSegment<int> segment{std::move(values)};
+  EXPECT_EQ(segment.size(), 3u);
+
+  const std::vector<int> more_values{4, 5, 6, 7};
+  segment.append_values(more_values.cbegin() + 1, more_values.cend());
+  EXPECT_EQ(segment.values(), (std::vector<int>{1, 2, 3, 5, 6, 7}));
+}
+
+TEST_F(StorageValueSegmentTest, EstimateMemoryUsage) {
+  const auto empty_usage = int_value_segment.estimate_memory_usage();
+  for (int i = 0; i < 100; ++i) int_value_segment.append(i);
+  EXPECT_GE(int_value_segment.estimate_memory_usage(), empty_usage + 100 * sizeof(int));
+
+  // Long strings are stored on the heap, short ones are not
+  string_value_segment.append("a");
+  const auto short_string_usage = string_value_segment.estimate_memory_usage();
+  string_value_segment.append(std::string(1000, 'a'));
+  EXPECT_GE(string_value_segment.estimate_memory_usage(), short_string_usage + 1000);
+}
+
 }  // namespace opossum